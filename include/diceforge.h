@@ -4,5 +4,8 @@
 #include "diceforge_core.h"
 #include "diceforge_distributions.h"
 #include "diceforge_generators.h"
+#include "diceforge_parallel.h"
+#include "diceforge_simulation.h"
+#include "diceforge_montecarlo.h"
 
 #endif
\ No newline at end of file
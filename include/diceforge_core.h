@@ -4,7 +4,13 @@
 #include <limits>
 #include <iostream>
 #include <algorithm>
+#include <type_traits>
+#include <random>
 #include <vector>
+#include <iterator>
+#include <unordered_map>
+#include <tuple>
+#include <stdexcept>
 
 #define _USE_MATH_DEFINES
 #include <cmath>
@@ -51,6 +57,135 @@ namespace DiceForge
 
 #endif
 
+    /// @brief DiceForge::AliasTable - An alias table (Walker, Vose) for drawing indices with given weights
+    /// @note Building the table takes O(n) time, after which every draw takes O(1) time and a single uniform random number
+    class AliasTable
+    {
+    public:
+        /// @brief Constructs an empty table, a built one must be assigned to it before drawing
+        AliasTable() = default;
+        /// @brief Builds the alias table of the given weights
+        /// @param weights_first Iterator of weight of first element (like .begin() of vectors)
+        /// @param weights_last Iterator after weight of last element (like .end() of vectors)
+        template <typename InputIterator>
+        AliasTable(InputIterator weights_first, InputIterator weights_last)
+        {
+            std::vector<real_t> p;
+            for (auto it = weights_first; it != weights_last; it++){
+                p.push_back(real_t(*it));
+            }
+            size_t n = p.size();
+            if (n == 0){
+                throw std::invalid_argument("Weight sequence must have non-zero length!");
+            }
+            real_t total = 0;
+            for (size_t i = 0; i < n; i++){
+                if (!(p[i] >= 0)){
+                    throw std::invalid_argument("Weights must be non-negative!");
+                }
+                total += p[i];
+            }
+            if (!(total > 0) || std::isinf(total)){
+                throw std::invalid_argument("Weights must have a positive and finite sum!");
+            }
+
+            // Vose's method: every entry below the average is topped up by one above it
+            table.resize(n);
+            std::vector<size_t> small, large;
+            for (size_t i = 0; i < n; i++){
+                p[i] = p[i] * n / total;
+                if (p[i] < 1)
+                    small.push_back(i);
+                else
+                    large.push_back(i);
+            }
+            while (!small.empty() && !large.empty()){
+                size_t s = small.back(), l = large.back();
+                small.pop_back();
+                table[s] = {p[s], l};
+                p[l] = (p[l] + p[s]) - 1;
+                if (p[l] < 1){
+                    large.pop_back();
+                    small.push_back(l);
+                }
+            }
+            // Whatever is left is 1 up to rounding errors
+            for (size_t i : large){
+                table[i] = {1, i};
+            }
+            for (size_t i : small){
+                table[i] = {1, i};
+            }
+        }
+
+        /// @brief Returns the number of weights in the table
+        size_t size() const
+        {
+            return table.size();
+        }
+
+        /// @brief Returns a random index, drawn with probability proportional to its weight
+        /// @param r a uniformly distributed unit random variable
+        size_t index(real_t r) const
+        {
+            // The integer part of r * n picks the column, the fractional part decides between it and its alias
+            real_t u = r * table.size();
+            size_t i = std::min(size_t(u), table.size() - 1);
+            return (u - i) < table[i].threshold ? i : table[i].alias;
+        }
+
+    private:
+        struct Entry
+        {
+            real_t threshold;   // Probability of keeping the column's own index
+            size_t alias;       // Index returned otherwise
+        };
+        std::vector<Entry> table;
+    };
+
+    /// @brief Reduces a random word to [0, range) by Lemire's multiply-shift, as the high half of x * range
+    /// @param x random word, uniformly distributed over all values of T
+    /// @param range size of the range (non-zero)
+    /// @param low receives the low half of x * range; the result is unbiased if the words with low < 2^w mod range are redrawn
+    template <typename T>
+    inline T multiply_shift(T x, T range, T& low)
+    {
+        if constexpr (sizeof(T) <= sizeof(uint32_t)) {
+            uint64_t m = uint64_t(x) * uint64_t(range);
+            low = T(m);
+            return T(m >> (8 * sizeof(T)));
+        }
+        else {
+            uint128_t m = uint128_t(x) * uint128_t(range);
+            low = T(m);
+            return T(m >> 64);
+        }
+    }
+
+    /// @brief Converts a random word to a real in [0, 1) with a single multiplication, keeping the top 53 bits of 64-bit words
+    /// and all the bits of narrower words
+    /// @param x random word, uniformly distributed over all values of T
+    template <typename T>
+    inline real_t word_to_unit(T x)
+    {
+        if constexpr (sizeof(T) >= sizeof(uint64_t))
+            return real_t(uint64_t(x) >> 11) * 0x1.0p-53;
+        else
+            return real_t(x) * (1 / (real_t(std::numeric_limits<T>().max()) + 1));
+    }
+
+    /// @brief Converts a random word to a real in the open interval (0, 1), the midpoint of one of 2^52 (64-bit words)
+    /// or 2^w (narrower words) equal cells, so that its logarithm is always finite
+    /// @param x random word, uniformly distributed over all values of T
+    template <typename T>
+    inline real_t word_to_open_unit(T x)
+    {
+        if constexpr (sizeof(T) >= sizeof(uint64_t))
+            return (real_t(uint64_t(x) >> 12) + 0.5) * 0x1.0p-52;
+        else
+            return (real_t(x) + 0.5) * (1 / (real_t(std::numeric_limits<T>().max()) + 1));
+    }
+
     /// @brief DiceForge::Generator<T> - A generic class for RNGs
     /// @tparam T datatype of random number generated (RNG implementation specific)
     /// @note Every RNG implemented in DiceForge is derived from this base class.
@@ -59,6 +194,24 @@ namespace DiceForge
     class Generator
     {
     public:
+        typedef T result_type;
+        /// @brief Returns the smallest integer generated by the RNG
+        static constexpr T min()
+        {
+            return 0;
+        }
+        /// @brief Returns the largest integer generated by the RNG
+        static constexpr T max()
+        {
+            return std::numeric_limits<T>().max();
+        }
+        /// @brief Returns a random integer generated by the RNG, same as next()
+        /// @note With result_type, min() and max() this makes every RNG a UniformRandomBitGenerator,
+        /// so it can be passed to std::shuffle and to the distributions of the standard library
+        T operator()()
+        {
+            return generate();
+        }
         /// @brief Returns a random integer generated by the RNG
         /// @returns An unsigned integer (usually 32 or 64 bit)
         T next()
@@ -66,22 +219,38 @@ namespace DiceForge
             return generate();
         };
         /// @brief Returns a random real between 0 and 1
-        /// @returns An floating-point real number (64 bit)
+        /// @returns An floating-point real number (64 bit) in [0, 1)
+        /// @note Built from the top 53 bits of 64-bit RNGs (all 32 bits of 32-bit RNGs) with a single multiplication
         real_t next_unit()
         {
-            real_t x = 1.0;
-            while (x == 1.0) {
-                x = generate() / real_t(std::numeric_limits<T>().max());
-            }
-            return x;
+            return word_to_unit(generate());
+        }
+        /// @brief Returns a random real strictly between 0 and 1
+        /// @returns An floating-point real number (64 bit) in (0, 1)
+        /// @note For samplers taking the logarithm of the number, which is then always finite
+        real_t next_unit_open()
+        {
+            return word_to_open_unit(generate());
         }
         /// @brief Returns a random integer in the specified range
         /// @param min minimum value of the random number (inclusive)
         /// @param max maximum value of the random number (inclusive)
         /// @returns An signed integer (64 bit)
+        /// @note Integer only and unbiased (Lemire's multiply-shift with rejection), a division is needed only for the
+        /// rare draws that may have to be rejected
         int64_t next_in_range(T min, T max)
         {
-            return (int64_t)floor(next_unit() * (max - min + 1)) + min;
+            T range = max - min + 1;
+            if (range == 0)
+                return int64_t(T(generate() + min));
+
+            T low, x = multiply_shift(generate(), range, low);
+            if (low < range) {
+                T threshold = (T(0) - range) % range;
+                while (low < threshold)
+                    x = multiply_shift(generate(), range, low);
+            }
+            return int64_t(x) + min;
         };
         /// @brief Returns a random real number in the specified range
         /// @param min minimum value of the random number
@@ -102,6 +271,55 @@ namespace DiceForge
             reseed(seed);
         }
 
+        /// @brief Fills the buffer with random integers generated by the RNG
+        /// @param out pointer to the first element of the buffer
+        /// @param n number of random integers to be generated
+        /// @note Produces the same sequence as n successive calls to next()
+        void fill(T* out, size_t n)
+        {
+            generate_block(out, n);
+        }
+        /// @brief Fills the buffer with random reals between 0 and 1
+        /// @param out pointer to the first element of the buffer
+        /// @param n number of random reals to be generated
+        /// @note Produces the same sequence as n successive calls to next_unit()
+        void fill_unit(real_t* out, size_t n)
+        {
+            T block[fill_block_size];
+            while (n > 0)
+            {
+                size_t len = n < fill_block_size ? n : fill_block_size;
+                generate_block(block, len);
+                for (size_t i = 0; i < len; i++)
+                    out[i] = word_to_unit(block[i]);
+                out += len;
+                n -= len;
+            }
+        }
+        /// @brief Fills the buffer with random integers in the specified range
+        /// @param out pointer to the first element of the buffer
+        /// @param n number of random integers to be generated
+        /// @param min minimum value of the random numbers (inclusive)
+        /// @param max maximum value of the random numbers (inclusive)
+        /// @note For repeated draws from the same range: the random words are drawn in bulk and the rejection threshold
+        /// is computed once, the rare rejected words are redrawn one at a time
+        void fill_in_range(T* out, size_t n, T min, T max)
+        {
+            generate_block(out, n);
+            T range = max - min + 1;
+            if (range == 0)
+                return;
+
+            T threshold = (T(0) - range) % range;
+            for (size_t i = 0; i < n; i++)
+            {
+                T low, x = multiply_shift(out[i], range, low);
+                while (low < threshold)
+                    x = multiply_shift(generate(), range, low);
+                out[i] = x + min;
+            }
+        }
+
         /// @brief Returns a random element from the sequence
         /// @param first Iterator of first element (like .begin() of vectors)
         /// @param last Iterator after last element (like .end() of vectors)
@@ -127,32 +345,271 @@ namespace DiceForge
             else if (last == first){
                 throw std::invalid_argument("Sequence must have non-zero length!");
             }
-            auto cumulative_weights = (decltype(&(*weights_first)))malloc(sizeof(*weights_first) * (last - first));
-            auto prev = *weights_first;
-            prev = 0;
+            // Two passes over the weights instead of a table of cumulative weights, so nothing is allocated
+            auto total = *weights_first;
+            total = 0;
             for (auto it = weights_first; it != weights_last; it++){
-                cumulative_weights[it - weights_first] = prev + *it;
-                prev = cumulative_weights[it - weights_first];
+                total += *it;
+            }
+            auto target = next_unit() * total;
+            auto cumulative = total;
+            cumulative = 0;
+            for (auto it = weights_first; it != weights_last - 1; it++){
+                cumulative += *it;
+                if (cumulative > target){
+                    return *(first + (it - weights_first));
+                }
+            }
+            return *(last - 1);
+        };
+
+        /// @brief Returns k distinct elements of the sequence, chosen without replacement with probabilities proportional to their weights
+        /// @param first Iterator of first element (like .begin() of vectors)
+        /// @param last Iterator after last element (like .end() of vectors)
+        /// @param weights_first Iterator of weight of first element (like .begin() of vectors)
+        /// @param weights_last Iterator after weight of last element (like .end() of vectors)
+        /// @param k Number of elements to choose
+        /// @note Efraimidis-Spirakis: every element gets the key log(u) / w and the k largest keys are kept in a heap,
+        /// which takes O(n log k) time and O(k) memory. The elements are returned in the order in which successive weighted
+        /// draws would pick them, and those of zero weight are never chosen, so fewer than k are returned if fewer have a positive weight
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+        auto weighted_sample(RandomAccessIterator1 first, RandomAccessIterator1 last,
+                             RandomAccessIterator2 weights_first, RandomAccessIterator2 weights_last, size_t k)
+        {
+            typedef typename std::iterator_traits<RandomAccessIterator1>::value_type value_type;
+            if (last - first != weights_last - weights_first){
+                throw std::invalid_argument("Lengths of sequence and weight sequence must be equal!");
             }
-            auto ans = *(first + (std::upper_bound(cumulative_weights, &(cumulative_weights[last - first - 1]) + 1, next_unit() * cumulative_weights[last - first - 1]) - cumulative_weights));
-            free(cumulative_weights);
-            return ans;
+            if (k > size_t(last - first)){
+                throw std::invalid_argument("Sample size must not exceed the length of the sequence!");
+            }
+
+            // Min-heap of the k largest keys, each with the index of its element
+            std::vector<std::pair<real_t, size_t>> heap;
+            heap.reserve(k);
+            auto greater = [](const std::pair<real_t, size_t>& a, const std::pair<real_t, size_t>& b) { return a.first > b.first; };
+            for (size_t i = 0; k > 0 && i < size_t(last - first); i++)
+            {
+                real_t w = weights_first[i];
+                if (w < 0){
+                    throw std::invalid_argument("Weights must be non-negative!");
+                }
+                if (w == 0)
+                    continue;
+                real_t key = log(next_unit_open()) / w;
+                if (heap.size() < k) {
+                    heap.emplace_back(key, i);
+                    std::push_heap(heap.begin(), heap.end(), greater);
+                }
+                else if (key > heap.front().first) {
+                    std::pop_heap(heap.begin(), heap.end(), greater);
+                    heap.back() = std::make_pair(key, i);
+                    std::push_heap(heap.begin(), heap.end(), greater);
+                }
+            }
+
+            std::sort_heap(heap.begin(), heap.end(), greater);
+            std::vector<value_type> result;
+            result.reserve(heap.size());
+            for (auto& entry : heap)
+                result.push_back(first[entry.second]);
+            return result;
+        };
+
+        /// @brief Returns k elements chosen without replacement with probabilities proportional to their weights,
+        /// from a sequence of unknown length, in one pass
+        /// @param first Iterator of first element (an input iterator is enough, like that of a stream)
+        /// @param last Iterator after last element
+        /// @param k Number of elements to choose
+        /// @param weight Function returning the weight of an element
+        /// @note Weighted reservoir sampling with exponential jumps (Efraimidis-Spirakis A-ExpJ): after each replacement the total
+        /// weight to pass over before the next one is drawn at once, so O(k log(n / k)) random numbers are drawn and O(k) memory is used.
+        /// The elements are returned in the order in which successive weighted draws would pick them, and those of zero weight are never chosen
+        template <typename InputIterator, typename WeightFunction>
+        auto weighted_reservoir_sample(InputIterator first, InputIterator last, size_t k, WeightFunction weight)
+        {
+            typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+            typedef std::pair<real_t, value_type> entry_t;
+            std::vector<entry_t> heap;
+            auto greater = [](const entry_t& a, const entry_t& b) { return a.first > b.first; };
+            heap.reserve(k);
+
+            for (; k > 0 && first != last && heap.size() < k; ++first)
+            {
+                real_t w = weight(*first);
+                if (w < 0){
+                    throw std::invalid_argument("Weights must be non-negative!");
+                }
+                if (w == 0)
+                    continue;
+                heap.emplace_back(log(next_unit_open()) / w, *first);
+                std::push_heap(heap.begin(), heap.end(), greater);
+            }
+
+            if (k > 0 && heap.size() == k)
+            {
+                // Total weight passed over before the smallest key is replaced
+                real_t jump = log(next_unit_open()) / heap.front().first;
+                for (; first != last; ++first)
+                {
+                    real_t w = weight(*first);
+                    if (w < 0){
+                        throw std::invalid_argument("Weights must be non-negative!");
+                    }
+                    jump -= w;
+                    if (jump > 0)
+                        continue;
+
+                    // The new key is conditioned on beating the smallest one, i.e. u uniform in (exp(w * smallest), 1)
+                    real_t t = exp(w * heap.front().first);
+                    real_t u = t + (1 - t) * next_unit_open();
+                    std::pop_heap(heap.begin(), heap.end(), greater);
+                    heap.back() = entry_t(log(u) / w, *first);
+                    std::push_heap(heap.begin(), heap.end(), greater);
+                    jump = log(next_unit_open()) / heap.front().first;
+                }
+            }
+
+            std::sort_heap(heap.begin(), heap.end(), greater);
+            std::vector<value_type> result;
+            result.reserve(heap.size());
+            for (auto& entry : heap)
+                result.push_back(entry.second);
+            return result;
+        };
+
+        /// @brief Returns a random element from the sequence, with weights prepared beforehand
+        /// @param first Iterator of first element (like .begin() of vectors)
+        /// @param last Iterator after last element (like .end() of vectors)
+        /// @param table Alias table built from the weights of the elements, in the same order
+        /// @note Unlike the overload taking the weights, this does not rebuild anything, so each call takes O(1) time
+        template <typename RandomAccessIterator>
+        auto choice(RandomAccessIterator first, RandomAccessIterator last, const AliasTable& table)
+        {
+            if (size_t(last - first) != table.size()){
+                throw std::invalid_argument("Lengths of sequence and weight sequence must be equal!");
+            }
+            return *(first + table.index(next_unit()));
+        };
+
+        /// @brief Returns k distinct elements of the sequence, chosen uniformly without replacement
+        /// @param first Iterator of first element (like .begin() of vectors)
+        /// @param last Iterator after last element (like .end() of vectors)
+        /// @param k Number of elements to choose
+        /// @note Partial Fisher-Yates shuffle of the indices, which are kept in a hash map when k is small compared to the
+        /// length of the sequence, so it takes O(k) time and memory. The sequence is not modified and the elements are returned in random order
+        template <typename RandomAccessIterator>
+        auto sample(RandomAccessIterator first, RandomAccessIterator last, size_t k)
+        {
+            typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+            size_t n = last - first;
+            if (k > n){
+                throw std::invalid_argument("Sample size must not exceed the length of the sequence!");
+            }
+            std::vector<value_type> result;
+            result.reserve(k);
+            if (4 * k < n) {
+                // moved[j] is the index of the element swapped into place j, places not in the map hold their own element
+                std::unordered_map<size_t, size_t> moved;
+                moved.reserve(2 * k);
+                for (size_t i = 0; i < k; i++) {
+                    size_t j = next_in_range(i, n - 1);
+                    auto at_j = moved.find(j);
+                    size_t picked = at_j == moved.end() ? j : at_j->second;
+                    auto at_i = moved.find(i);
+                    moved[j] = at_i == moved.end() ? i : at_i->second;
+                    result.push_back(first[picked]);
+                }
+            }
+            else {
+                std::vector<size_t> index(n);
+                for (size_t i = 0; i < n; i++)
+                    index[i] = i;
+                for (size_t i = 0; i < k; i++) {
+                    std::swap(index[i], index[next_in_range(i, n - 1)]);
+                    result.push_back(first[index[i]]);
+                }
+            }
+            return result;
+        };
+
+        /// @brief Returns k elements chosen uniformly without replacement from a sequence of unknown length, in one pass
+        /// @param first Iterator of first element (an input iterator is enough, like that of a stream)
+        /// @param last Iterator after last element
+        /// @param k Number of elements to choose
+        /// @note Reservoir sampling with geometric skips (Li's Algorithm L), so O(k (1 + log(n / k))) random numbers are drawn
+        /// for n elements and O(k) memory is used. If the sequence has fewer than k elements, all of them are returned
+        template <typename InputIterator>
+        auto reservoir_sample(InputIterator first, InputIterator last, size_t k)
+        {
+            typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+            std::vector<value_type> reservoir;
+            if (k == 0)
+                return reservoir;
+            reservoir.reserve(k);
+            for (; first != last && reservoir.size() < k; ++first)
+                reservoir.push_back(*first);
+
+            real_t w = exp(log(next_unit_open()) / k);
+            while (first != last)
+            {
+                // The number of elements passed over before the next one enters the reservoir is geometric
+                real_t skip = floor(log(next_unit_open()) / log1p(-w));
+                for (; skip > 0 && first != last; skip--)
+                    ++first;
+                if (first == last)
+                    break;
+                reservoir[next_in_range(0, k - 1)] = *first;
+                ++first;
+                w *= exp(log(next_unit_open()) / k);
+            }
+            return reservoir;
         };
 
         /// @brief Shuffles the sequence in place
         /// @param first Iterator of first element (like .begin() of vectors)
         /// @param last Iterator after last element (like .end() of vectors)
+        /// @note Fisher-Yates shuffle, swapping the elements in place without allocating or copying the sequence
         template <typename RandomAccessIterator>
         void shuffle(RandomAccessIterator first, RandomAccessIterator last)
         {
-            auto temp = (decltype(&(*first)))malloc(sizeof(*first) * (last - first));
-            for (auto it = first; it != last; it++){
-                temp[it - first] = *it;
-            }
-            shuffle_array(temp, last - first);
-            for (auto it = first; it!= last; it++){
-                *it = temp[it - first];
+            using std::swap;
+            for (T i = T(last - first); i > 1; i--)
+                swap(first[i - 1], first[next_in_range(0, i - 1)]);
+        };
+
+        /// @brief Shuffles the sequence in place, drawing the positions of two swaps from each random number
+        /// @param first Iterator of first element (like .begin() of vectors)
+        /// @param last Iterator after last element (like .end() of vectors)
+        /// @note Batched Fisher-Yates shuffle (Brackett-Rozinsky & Lemire): while i (i - 1) fits in T, the positions for i and
+        /// i - 1 are the mixed radix digits of a single random number times i (i - 1), which halves the calls to the RNG.
+        /// It is as uniform as shuffle(), but gives a different permutation for the same seed
+        template <typename RandomAccessIterator>
+        void shuffle_batched(RandomAccessIterator first, RandomAccessIterator last)
+        {
+            using std::swap;
+            constexpr T pair_limit = T(1) << (4 * sizeof(T));
+            T i = T(last - first);
+            for (; i > pair_limit; i--)
+                swap(first[i - 1], first[next_in_range(0, i - 1)]);
+
+            for (; i > 2; i -= 2)
+            {
+                T product = i * (i - 1), low;
+                T j = multiply_shift(generate(), i, low);
+                T k = multiply_shift(low, T(i - 1), low);
+                if (low < product) {
+                    T threshold = (T(0) - product) % product;
+                    while (low < threshold) {
+                        j = multiply_shift(generate(), i, low);
+                        k = multiply_shift(low, T(i - 1), low);
+                    }
+                }
+                swap(first[i - 1], first[j]);
+                swap(first[i - 2], first[k]);
             }
+            if (i == 2)
+                swap(first[0], first[next_in_range(0, 1)]);
         };
         /*** Note: These are the only functions to be implemented by the implementation RNG ***/
     private:
@@ -160,24 +617,466 @@ namespace DiceForge
         virtual T generate() = 0;
         /// @brief Should initialize the seed for the RNG
         virtual void reseed(T seed) = 0;
-        /// @brief Shuffles the array in place
-        /// @param arr Pointer to the first element
-        /// @param len Length of the array
-        template <typename other_T>
-        void shuffle_array(other_T arr[], T len) {
-            T ind;
-            std::vector<other_T> v;
-            for (int i = 0; i < len; i++) {
-                v.push_back(arr[i]);
-            }
-            for (int i = 0; i < len; i++) {
-                ind = next_in_range(0, len - i - 1);
-                arr[i] = v[ind];
-                v.erase(v.begin() + ind);
+        /// @brief Writes n random integers to out, equivalent to n calls to generate()
+        /// @note RNGs may override this with a tighter loop to avoid a virtual call per number
+        virtual void generate_block(T* out, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+                out[i] = generate();
+        }
+        /// @brief Number of integers drawn at a time by fill_unit
+        static constexpr size_t fill_block_size = 256;
+    };
+
+    /// @brief DiceForge::StaticGenerator<T, Derived> - A generic class for RNGs resolved at compile time (CRTP)
+    /// @tparam T datatype of random number generated (RNG implementation specific)
+    /// @tparam Derived the RNG implementation, which provides T generate() (StaticGenerator may be made a friend to keep it private)
+    /// @note Offers the interface of Generator<T> without virtual functions, so that generate() is inlined into next_unit()
+    /// and into the samplers of the distributions when the RNG type is known at compile time
+    /// @note Also meets the requirements of a UniformRandomBitGenerator of the standard library
+    template <typename T, typename Derived>
+    class StaticGenerator
+    {
+    public:
+        typedef T result_type;
+        /// @brief Returns the smallest integer generated by the RNG
+        static constexpr T min()
+        {
+            return 0;
+        }
+        /// @brief Returns the largest integer generated by the RNG
+        static constexpr T max()
+        {
+            return std::numeric_limits<T>().max();
+        }
+        /// @brief Returns a random integer generated by the RNG, same as next()
+        T operator()()
+        {
+            return derived().generate();
+        }
+        /// @brief Returns a random integer generated by the RNG
+        /// @returns An unsigned integer (usually 32 or 64 bit)
+        T next()
+        {
+            return derived().generate();
+        }
+        /// @brief Returns a random real between 0 and 1
+        /// @returns An floating-point real number (64 bit) in [0, 1)
+        /// @note Built from the top 53 bits of 64-bit RNGs (all 32 bits of 32-bit RNGs) with a single multiplication
+        real_t next_unit()
+        {
+            return word_to_unit(derived().generate());
+        }
+        /// @brief Returns a random real strictly between 0 and 1
+        /// @returns An floating-point real number (64 bit) in (0, 1)
+        /// @note For samplers taking the logarithm of the number, which is then always finite
+        real_t next_unit_open()
+        {
+            return word_to_open_unit(derived().generate());
+        }
+        /// @brief Returns a random integer in the specified range
+        /// @param min minimum value of the random number (inclusive)
+        /// @param max maximum value of the random number (inclusive)
+        /// @returns An signed integer (64 bit)
+        /// @note Integer only and unbiased (Lemire's multiply-shift with rejection), a division is needed only for the
+        /// rare draws that may have to be rejected
+        int64_t next_in_range(T min, T max)
+        {
+            T range = max - min + 1;
+            if (range == 0)
+                return int64_t(T(derived().generate() + min));
+
+            T low, x = multiply_shift(derived().generate(), range, low);
+            if (low < range) {
+                T threshold = (T(0) - range) % range;
+                while (low < threshold)
+                    x = multiply_shift(derived().generate(), range, low);
             }
-        };
+            return int64_t(x) + min;
+        }
+        /// @brief Returns a random real number in the specified range
+        /// @param min minimum value of the random number
+        /// @param max maximum value of the random number
+        /// @returns An signed floating-point real number (64 bit)
+        real_t next_in_crange(real_t min, real_t max)
+        {
+            real_t x = (real_t)max;
+            while (x == max) {
+                x = (max - min) * next_unit() + min;
+            }
+            return x;
+        }
+        /// @brief Fills the buffer with random integers generated by the RNG
+        /// @param out pointer to the first element of the buffer
+        /// @param n number of random integers to be generated
+        void fill(T* out, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+                out[i] = derived().generate();
+        }
+        /// @brief Fills the buffer with random reals between 0 and 1
+        /// @param out pointer to the first element of the buffer
+        /// @param n number of random reals to be generated
+        void fill_unit(real_t* out, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+                out[i] = next_unit();
+        }
+        /// @brief Fills the buffer with random integers in the specified range
+        /// @param out pointer to the first element of the buffer
+        /// @param n number of random integers to be generated
+        /// @param min minimum value of the random numbers (inclusive)
+        /// @param max maximum value of the random numbers (inclusive)
+        /// @note For repeated draws from the same range: the random words are drawn in bulk and the rejection threshold
+        /// is computed once, the rare rejected words are redrawn one at a time
+        void fill_in_range(T* out, size_t n, T min, T max)
+        {
+            fill(out, n);
+            T range = max - min + 1;
+            if (range == 0)
+                return;
+
+            T threshold = (T(0) - range) % range;
+            for (size_t i = 0; i < n; i++)
+            {
+                T low, x = multiply_shift(out[i], range, low);
+                while (low < threshold)
+                    x = multiply_shift(derived().generate(), range, low);
+                out[i] = x + min;
+            }
+        }
+    protected:
+        ~StaticGenerator() = default;
+    private:
+        Derived& derived()
+        {
+            return static_cast<Derived&>(*this);
+        }
+    };
+
+    /// @brief True for the DiceForge RNGs, those derived from DiceForge::Generator or DiceForge::StaticGenerator
+    /// (anything with next(), next_unit() and next_unit_open())
+    template <typename G, typename = void>
+    struct is_generator : std::false_type {};
+
+    template <typename G>
+    struct is_generator<G, std::void_t<decltype(std::declval<G&>().next()), decltype(std::declval<G&>().next_unit()),
+        decltype(std::declval<G&>().next_unit_open())>> : std::true_type {};
+
+#if (__cplusplus >= 202002L)
+    /// @brief DiceForge::UniformGenerator - Concept of the DiceForge RNGs, which are UniformRandomBitGenerators as well
+    template <typename G>
+    concept UniformGenerator = is_generator<G>::value && std::uniform_random_bit_generator<G>;
+#endif
+
+    /// @brief True for the types meeting the requirements of a UniformRandomBitGenerator (result_type, min(), max()
+    /// and operator()), including every DiceForge RNG and the engines of the standard library
+    template <typename G, typename = void>
+    struct is_bit_generator : std::false_type {};
+
+    template <typename G>
+    struct is_bit_generator<G, std::void_t<typename G::result_type, decltype(G::min()), decltype(G::max()), decltype(std::declval<G&>()())>>
+        : std::is_unsigned<typename G::result_type> {};
+
+    /// @brief DiceForge::EngineAdapter<URBG> - Presents any UniformRandomBitGenerator (such as std::mt19937) as a DiceForge RNG
+    /// @tparam URBG type of the engine, which is drawn from in place through a reference (it is not copied)
+    /// @note Generates 64-bit unsigned integers, joining two draws of 32-bit engines
+    template <typename URBG>
+    class EngineAdapter : public StaticGenerator<uint64_t, EngineAdapter<URBG>>
+    {
+    private:
+        friend class StaticGenerator<uint64_t, EngineAdapter<URBG>>;
+        URBG& engine;
+        uint64_t generate()
+        {
+            constexpr uint64_t range = uint64_t(URBG::max()) - uint64_t(URBG::min());
+            if constexpr (range == std::numeric_limits<uint64_t>().max())
+                return uint64_t(engine() - URBG::min());
+            else if constexpr (range == 0xFFFFFFFF) {
+                uint64_t hi = uint64_t(engine() - URBG::min());
+                return (hi << 32) | uint64_t(engine() - URBG::min());
+            }
+            else
+                return std::uniform_int_distribution<uint64_t>()(engine);
+        }
+    public:
+        /// @brief Wraps the given engine
+        /// @param engine engine to draw from, it must outlive the adapter
+        explicit EngineAdapter(URBG& engine) : engine(engine) {}
+    };
+
+    /// @brief Returns the RNG itself if it is a DiceForge RNG, or an EngineAdapter drawing from it otherwise
+    /// @param rng any DiceForge RNG or UniformRandomBitGenerator
+    /// @note Lets the distributions take standard library engines directly
+    template <typename G>
+    decltype(auto) as_generator(G& rng)
+    {
+        if constexpr (is_generator<G>::value)
+            return (rng);
+        else
+            return EngineAdapter<G>(rng);
+    }
+
+    /// @brief DiceForge::DynamicTable - A table of weights for drawing indices, whose weights can be changed one at a time
+    /// @note Fenwick (binary indexed) tree of the weights: drawing an index and changing a weight both take O(log n) time,
+    /// where an AliasTable draws in O(1) time but has to be rebuilt in O(n) time after every change
+    class DynamicTable
+    {
+    public:
+        /// @brief Constructs an empty table, a built one must be assigned to it before drawing
+        DynamicTable() = default;
+        /// @brief Constructs a table of n weights, all zero
+        /// @param n number of weights
+        explicit DynamicTable(size_t n) : weights(n, 0)
+        {
+            rebuild();
+        }
+        /// @brief Builds the table of the given weights in O(n) time
+        /// @param weights_first Iterator of weight of first element (like .begin() of vectors)
+        /// @param weights_last Iterator after weight of last element (like .end() of vectors)
+        template <typename InputIterator>
+        DynamicTable(InputIterator weights_first, InputIterator weights_last)
+        {
+            for (auto it = weights_first; it != weights_last; it++){
+                real_t w = real_t(*it);
+                if (!(w >= 0) || std::isinf(w)){
+                    throw std::invalid_argument("Weights must be non-negative and finite!");
+                }
+                weights.push_back(w);
+            }
+            rebuild();
+        }
+
+        /// @brief Returns the number of weights in the table
+        size_t size() const
+        {
+            return weights.size();
+        }
+
+        /// @brief Returns the weight of index i
+        real_t weight(size_t i) const
+        {
+            return weights[i];
+        }
+
+        /// @brief Returns the sum of the weights, in O(log n) time
+        real_t total() const
+        {
+            real_t sum = 0;
+            for (size_t j = weights.size(); j > 0; j -= j & (~j + 1))
+                sum += tree[j];
+            return sum;
+        }
+
+        /// @brief Changes the weight of index i, in O(log n) time
+        /// @param i index whose weight is changed
+        /// @param w new weight
+        /// @note The tree is rebuilt from the weights once every n changes (O(1) amortized),
+        /// so the rounding errors of the changes do not pile up
+        void update(size_t i, real_t w)
+        {
+            if (i >= weights.size()){
+                throw std::invalid_argument("Index must be less than the number of weights!");
+            }
+            if (!(w >= 0) || std::isinf(w)){
+                throw std::invalid_argument("Weights must be non-negative and finite!");
+            }
+            real_t delta = w - weights[i];
+            weights[i] = w;
+            if (++updates >= weights.size()){
+                rebuild();
+                return;
+            }
+            for (size_t j = i + 1; j <= weights.size(); j += j & (~j + 1))
+                tree[j] += delta;
+        }
+
+        /// @brief Returns a random index, drawn with probability proportional to its weight, in O(log n) time
+        /// @param r a uniformly distributed unit random variable
+        /// @note Indices of zero weight are never returned
+        size_t index(real_t r) const
+        {
+            real_t sum = total();
+            if (!(sum > 0)){
+                throw std::invalid_argument("Weights must have a positive sum!");
+            }
+
+            // Descends the tree to the last index whose prefix sum does not exceed r * sum
+            real_t target = r * sum;
+            size_t pos = 0;
+            for (size_t step = top; step > 0; step >>= 1){
+                if (pos + step <= weights.size() && tree[pos + step] <= target){
+                    pos += step;
+                    target -= tree[pos];
+                }
+            }
+            // Past the end or on a zero weight only through rounding errors, fall back on the nearest index of positive weight below
+            for (size_t k = 0; pos >= weights.size() || weights[pos] == 0; k++){
+                if (k == weights.size()){
+                    throw std::invalid_argument("Weights must have a positive sum!");
+                }
+                pos = (pos == 0 ? weights.size() : pos) - 1;
+            }
+            return pos;
+        }
+
+        /// @brief Returns a random index, drawn with probability proportional to its weight, in O(log n) time
+        /// @param rng any DiceForge RNG or UniformRandomBitGenerator
+        template <typename G>
+        size_t sample(G& rng) const
+        {
+            return index(as_generator(rng).next_unit());
+        }
+
+    private:
+        /// @brief Builds the tree from the weights in O(n) time
+        void rebuild()
+        {
+            size_t n = weights.size();
+            tree.assign(n + 1, 0);
+            for (size_t i = 1; i <= n; i++){
+                tree[i] += weights[i - 1];
+                size_t j = i + (i & (~i + 1));
+                if (j <= n)
+                    tree[j] += tree[i];
+            }
+            top = 1;
+            while (2 * top <= n)
+                top *= 2;
+            updates = 0;
+        }
+
+        std::vector<real_t> weights;    // Weight of every index
+        std::vector<real_t> tree;       // tree[j] is the sum of the weights of indices j - lowbit(j) to j - 1
+        size_t top = 0;                 // Largest power of two not above the number of weights
+        size_t updates = 0;             // Changes since the tree was last rebuilt
+    };
+
+    /// @brief True for the distributions (and samplers) with an inverse-CDF next(r), taking one unit random variable
+    template <typename D, typename = void>
+    struct has_inverse_cdf : std::false_type {};
+
+    template <typename D>
+    struct has_inverse_cdf<D, std::void_t<decltype(std::declval<const D&>().next(std::declval<real_t>()))>> : std::true_type {};
+
+    /// @brief Randomisations of the quasi-random sequences, which keep their low discrepancy
+    /// and make independent replicas (for error estimates) out of different seeds
+    enum class Scrambling
+    {
+        none,       // The sequence itself
+        shift,      // The same random permutation of the digits at every position (a random XOR for base 2)
+        owen        // Nested uniform scrambling, the permutation of a digit depends on the digits before it
+    };
+
+    /// @brief DiceForge::QuasiGenerator - A generic class for low-discrepancy (quasi-random) sequences of points in (0, 1)^d
+    /// @note Unlike the pseudo-random generators, consecutive points fill the unit cube evenly, so averages over n points
+    /// converge at close to O(1/n) instead of O(1/sqrt(n)) for smooth integrands. Every coordinate of a point must be used
+    /// for a different variable, through the inverse-CDF next(r) of the distributions
+    class QuasiGenerator
+    {
+    public:
+        /// @brief Default destructor
+        virtual ~QuasiGenerator() = default;
+
+        /// @brief Returns the number of coordinates of every point
+        size_t dimension() const
+        {
+            return dims;
+        }
+
+        /// @brief Returns the index of the next point
+        uint64_t index() const
+        {
+            return n;
+        }
+
+        /// @brief Writes the next point to the array
+        /// @param point array of dimension() real numbers
+        void next(real_t* point)
+        {
+            generate(point);
+            n++;
+        }
+
+        /// @brief Returns the next point
+        std::vector<real_t> next()
+        {
+            std::vector<real_t> point(dims);
+            next(point.data());
+            return point;
+        }
+
+        /// @brief Returns the next point, with its coordinates mapped through the inverse-CDF next(r) of the distributions
+        /// @param dists distributions (or their samplers) whose next(r) takes one unit random variable, one per coordinate
+        /// @note Coordinates past the last distribution are dropped. Distributions whose next takes more than one unit random variable,
+        /// like Gaussian, can be given consecutive coordinates of next() by hand
+        template <typename... D>
+        auto next(const D&... dists)
+        {
+            static_assert((has_inverse_cdf<D>::value && ...),
+                "Every distribution must have a const next(real_t r), mapping one unit random variable to a sample!");
+            if (sizeof...(D) > dims){
+                throw std::invalid_argument("Every distribution must have a coordinate of its own!");
+            }
+            return map_point(next(), std::index_sequence_for<D...>(), dists...);
+        }
+
+        /// @brief Moves to the point of the given index, without generating the ones before it
+        /// @param i index of the next point
+        /// @note Lets threads work on disjoint blocks of the same sequence
+        void skip_to(uint64_t i)
+        {
+            seek(i);
+            n = i;
+        }
+
+        /// @brief Skips the given number of points
+        void discard(uint64_t count)
+        {
+            skip_to(n + count);
+        }
+
+    protected:
+        /// @brief Sets the dimension
+        QuasiGenerator(size_t dimension) : dims(dimension) {}
+        size_t dims;
+
+    private:
+        uint64_t n = 0;
+
+        // Coordinate I of the point goes to the I-th distribution, passed as a prvalue so that only next(real_t) matches
+        template <typename... D, size_t... I>
+        static auto map_point(const std::vector<real_t>& point, std::index_sequence<I...>, const D&... dists)
+        {
+            return std::tuple<decltype(dists.next(real_t()))...>{dists.next(real_t(point[I]))...};
+        }
+
+        /*** Note: These are the only functions to be implemented by the implementation sequence ***/
+        /// @brief Should write the point of index index() to the array
+        virtual void generate(real_t* point) = 0;
+        /// @brief Should move to the point of index i
+        virtual void seek(uint64_t i) = 0;
     };
 
+    /// @brief Returns log(k!) for a non-negative integer k, by Stirling's series with Hormann's correction term fc(k)
+    /// @note Unlike lgamma, it does not write the global signgam, so it can be called from several threads at once
+    inline real_t log_factorial(real_t k)
+    {
+        // fc(k) = log(k!) - log(sqrt(2 pi)) - (k + 0.5) log(k + 1) + (k + 1), tabulated for small k
+        static constexpr real_t fc_table[10] = {
+            0.08106146679532726, 0.04134069595540929, 0.02767792568499834, 0.02079067210376509, 0.01664469118982119,
+            0.01387612882307075, 0.01189670994589177, 0.01041126526197209, 0.009255462182712733, 0.008330563433362871
+        };
+        real_t fc;
+        if (k < 10)
+            fc = fc_table[int(k)];
+        else {
+            real_t x = k + 1, x2 = x * x;
+            fc = (1.0 / 12 - (1.0 / 360 - (1.0 / 1260 - 1.0 / (1680 * x2)) / x2) / x2) / x;
+        }
+        return 0.91893853320467274 + (k + 0.5) * log(k + 1) - (k + 1) + fc;
+    }
+
     /// @brief DiceForge::Continuous - A generic class for distributions describing continuous random variables
     class Continuous
     {
@@ -299,6 +1198,161 @@ namespace DiceForge
         }
     };
 
+    /**
+     * @brief A struct for modular arithmetic with an odd modulus of up to 512 bits.
+     * 
+     * Numbers are stored as little-endian arrays of 64-bit limbs. Products are reduced
+     * with Montgomery multiplication on native 128-bit products, so that no division is
+     * needed. A number a is represented in Montgomery form as aR mod n, with R = 2^(64 * limbs).
+     */
+    struct Montgomery {
+        static const int max_limbs = 8; /**< Maximum number of 64-bit limbs of the modulus. */
+        int limbs; /**< Number of 64-bit limbs of the modulus. */
+        uint64_t n[max_limbs]; /**< The modulus. */
+        uint64_t n_inv; /**< -n^(-1) mod 2^64. */
+        uint64_t r2[max_limbs]; /**< R^2 mod n, used for converting numbers into Montgomery form. */
+
+        /**
+         * @brief Constructs the Montgomery context of the given modulus.
+         * 
+         * @param modulus The limbs of the modulus, least significant first.
+         * @param size The number of limbs.
+         * @throws std::invalid_argument if the modulus is even, smaller than 3 or longer than max_limbs limbs.
+         */
+        Montgomery(const uint64_t* modulus, int size) {
+            while (size > 0 && modulus[size - 1] == 0)
+                size--;
+            if (size == 0 || size > max_limbs || (modulus[0] & 1) == 0 || (size == 1 && modulus[0] < 3))
+                throw std::invalid_argument("Montgomery modulus must be odd, at least 3 and at most 512 bits long!");
+
+            limbs = size;
+            for (int i = 0; i < max_limbs; i++)
+                n[i] = i < size ? modulus[i] : 0;
+
+            // Newton's iteration doubles the number of correct bits of n^(-1) mod 2^64 every step
+            uint64_t inv = n[0];
+            for (int i = 0; i < 5; i++)
+                inv *= 2 - n[0] * inv;
+            n_inv = 0 - inv;
+
+            // R^2 mod n by doubling 1 modulo n, 2 * 64 * limbs times
+            for (int i = 0; i < max_limbs; i++)
+                r2[i] = 0;
+            r2[0] = 1;
+            for (int k = 0; k < 128 * limbs; k++) {
+                uint64_t carry = 0;
+                for (int i = 0; i < limbs; i++) {
+                    uint64_t top = r2[i] >> 63;
+                    r2[i] = (r2[i] << 1) | carry;
+                    carry = top;
+                }
+                if (carry || !less(r2, n))
+                    subtract_n(r2);
+            }
+        }
+
+        /**
+         * @brief Returns the number of significant bits of the modulus.
+         */
+        int bit_length() const {
+            int bits = 64 * limbs;
+            for (uint64_t top = n[limbs - 1]; (top >> 63) == 0; top <<= 1)
+                bits--;
+            return bits;
+        }
+
+        /**
+         * @brief Computes out = a * b * R^(-1) mod n (CIOS method).
+         * 
+         * @param a The first factor, smaller than n.
+         * @param b The second factor, smaller than n.
+         * @param out The product, may alias a or b.
+         */
+        void mul(const uint64_t* a, const uint64_t* b, uint64_t* out) const {
+            uint64_t t[max_limbs + 2] = {};
+            for (int i = 0; i < limbs; i++) {
+                uint128_t c = 0;
+                for (int j = 0; j < limbs; j++) {
+                    c += uint128_t(a[j]) * b[i] + t[j];
+                    t[j] = uint64_t(c);
+                    c >>= 64;
+                }
+                c += t[limbs];
+                t[limbs] = uint64_t(c);
+                t[limbs + 1] = uint64_t(c >> 64);
+
+                uint64_t m = t[0] * n_inv;
+                c = (uint128_t(m) * n[0] + t[0]) >> 64;
+                for (int j = 1; j < limbs; j++) {
+                    c += uint128_t(m) * n[j] + t[j];
+                    t[j - 1] = uint64_t(c);
+                    c >>= 64;
+                }
+                c += t[limbs];
+                t[limbs - 1] = uint64_t(c);
+                t[limbs] = t[limbs + 1] + uint64_t(c >> 64);
+            }
+            if (t[limbs] != 0 || !less(t, n))
+                subtract_n(t);
+            for (int i = 0; i < limbs; i++)
+                out[i] = t[i];
+        }
+
+        /**
+         * @brief Converts a number smaller than n into Montgomery form.
+         */
+        void to_montgomery(const uint64_t* a, uint64_t* out) const {
+            mul(a, r2, out);
+        }
+
+        /**
+         * @brief Converts a number out of Montgomery form.
+         */
+        void from_montgomery(const uint64_t* a, uint64_t* out) const {
+            uint64_t one[max_limbs] = {1};
+            mul(a, one, out);
+        }
+
+        /**
+         * @brief Computes a * b * R^(-1) mod n for a single-limb modulus.
+         */
+        uint64_t mul64(uint64_t a, uint64_t b) const {
+            uint128_t t = uint128_t(a) * b;
+            // m * n has the same low half as t, so (t - m * n) / 2^64 is just the difference of the high halves
+            uint64_t m = uint64_t(t) * (0 - n_inv);
+            uint64_t th = uint64_t(t >> 64), mh = uint64_t((uint128_t(m) * n[0]) >> 64);
+            uint64_t u = th - mh;
+            return u + (th < mh ? n[0] : 0);
+        }
+
+        /**
+         * @brief Converts a number out of Montgomery form for a single-limb modulus.
+         */
+        uint64_t from_montgomery64(uint64_t a) const {
+            uint64_t m = a * (0 - n_inv);
+            uint64_t mh = uint64_t((uint128_t(m) * n[0]) >> 64);
+            return (0 - mh) + (mh != 0 ? n[0] : 0);
+        }
+
+    private:
+        bool less(const uint64_t* a, const uint64_t* b) const {
+            for (int i = limbs - 1; i >= 0; i--) {
+                if (a[i] != b[i])
+                    return a[i] < b[i];
+            }
+            return false;
+        }
+
+        void subtract_n(uint64_t* a) const {
+            uint64_t borrow = 0;
+            for (int i = 0; i < limbs; i++) {
+                uint64_t d = a[i] - n[i] - borrow;
+                borrow = (a[i] < n[i]) || (a[i] == n[i] && borrow);
+                a[i] = d;
+            }
+        }
+    };
+
     #if (__cplusplus >= 202002L)  // Atleast C++ 20 is required to use integration for 2D Random Variables
 
     /* Helper functions for integration of 2D PDF */
@@ -18,7 +18,23 @@ namespace DiceForge {
             Cauchy(real_t x0 = 0, real_t gamma = 1);
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            real_t next(real_t r);
+            real_t next(real_t r) const;
+            /// @brief DiceForge::Cauchy::Sampler - Draws from the distribution, with the location and scale copied out of it
+            class Sampler {
+                private:
+                    friend class Cauchy;
+                    real_t x0, gamma;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    real_t operator()(G& rng) const
+                    {
+                        return gamma * tan(M_PI * (as_generator(rng).next_unit() - 0.5)) + x0;
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             /// @note The variation of a Cauchy distribution is undefined
             /// @returns NaN
@@ -62,7 +78,9 @@ namespace DiceForge {
         real_t lower_limit;
         real_t upper_limit;
         real_t m_expectation, m_variance;
-        std::vector<std::pair<real_t, real_t>> cdf_values; // (input, cdf)
+        real_t step; // Width of the intervals of the table
+        std::vector<real_t> cdf_values; // Integral of the pdf from lower_limit up to lower_limit + k * step
+        std::vector<size_t> guide; // guide[j] is the first interval where the cdf reaches j / guide.size() of the total (Chen & Asau)
         PDF_Function pdf_function; // Declare pdf_function as a member variable
 
     public:
@@ -70,13 +88,33 @@ namespace DiceForge {
         /// @param lower lower bound for the random variable (finite)
         /// @param upper upper bound for the random variable (finite)
         /// @param pdf probability density function describing the distribution
-        /// @param n number of points where the pdf should be sampled for expectation, variance and cdf calculations (higher n provides better accuracy) 
+        /// @param n number of intervals the range is split into for expectation, variance and cdf calculations (higher n provides better accuracy)
+        /// @note The pdf is evaluated 2n + 1 times while constructing the distribution, and twice per cdf evaluation
         CustomDistribution(real_t lower, real_t upper, PDF_Function pdf, int n);
 
         /// @brief Returns the next value of the random variable described by the distribution
         /// @param r A random real number uniformly distributed between 0 and 1
-        real_t next(real_t r);
+        /// @note Takes O(1) expected time, the cdf is interpolated linearly within the intervals of the table
+        real_t next(real_t r) const;
         
+        /// @brief DiceForge::CustomDistribution::Sampler - Draws from the distribution through its cdf table
+        class Sampler {
+            private:
+                friend class CustomDistribution;
+                const CustomDistribution* dist;
+            public:
+                /// @brief Returns the next value of the random variable described by the distribution
+                /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                template <typename G>
+                real_t operator()(G& rng) const
+                {
+                    return dist->next(as_generator(rng).next_unit());
+                }
+        };
+        /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+        /// @note The sampler refers to the tables of the distribution, which must outlive it
+        Sampler prepare() const;
+
         /// @brief Returns the expected value of the distribution
         /// @note The expectation value is approximate
         real_t expectation() const override final;
@@ -116,7 +154,27 @@ namespace DiceForge {
         /// @brief Generate a random number from the exponential distribution.
         /// @param r Uniformly distributed random number in the range [0,1).
         /// @returns Random number from the exponential distribution.
-        real_t next(real_t r);
+        real_t next(real_t r) const;
+
+        /// @brief DiceForge::Exponential::Sampler - Draws from the distribution, with the negated inverse rate precomputed
+        class Sampler {
+            private:
+                friend class Exponential;
+                real_t x0, scale; // scale = -1 / k
+            public:
+                /// @brief Generate a random number from the exponential distribution.
+                /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937).
+                /// @returns Random number from the exponential distribution.
+                template <typename G>
+                real_t operator()(G& rng) const
+                {
+                    return x0 + log(as_generator(rng).next_unit_open()) * scale;
+                }
+        };
+
+        /// @brief Prepare a sampler of the distribution, for drawing many values with the same parameters.
+        /// @returns Sampler of the exponential distribution.
+        Sampler prepare() const;
 
         ///@brief Calculate the variance of the distribution.
         /// @returns Variance of the exponential distribution.
@@ -165,6 +223,63 @@ namespace DiceForge {
         private:
             real_t mu, sigma;
             real_t myerf(real_t x) const;
+
+            // Ziggurat of 256 layers of equal area (Marsaglia & Tsang), layer i spans [0, x[i]) below
+            // the density at x[i + 1] and the bottom layer also holds the tail beyond x[1]
+            struct Ziggurat {
+                real_t x[257];  // Right edges of the layers, decreasing down to x[256] = 0
+                real_t f[257];  // Unnormalized density exp(-x^2 / 2) at the edges
+                Ziggurat();
+            };
+            static const Ziggurat& ziggurat();
+            const Ziggurat* zig;
+
+            // 64 random bits from the generator, concatenating draws of narrower generators
+            template <typename G>
+            static uint64_t random_bits(G& rng)
+            {
+                if constexpr (sizeof(rng.next()) >= sizeof(uint64_t))
+                    return uint64_t(rng.next());
+                else {
+                    uint64_t hi = uint64_t(rng.next());
+                    return (hi << 32) | uint64_t(rng.next());
+                }
+            }
+
+            // Standard normal variate, starting from the given 64 random bits (layer in the lowest 8 bits,
+            // signed abscissa in the highest 53 bits)
+            template <typename G>
+            real_t standard(G& rng, uint64_t bits) const
+            {
+                const real_t* x = zig->x;
+                const real_t* f = zig->f;
+                for (;;)
+                {
+                    int i = bits & 0xFF;
+                    real_t z = real_t(int64_t(bits) >> 11) * 0x1.0p-52 * x[i];
+
+                    // Inside the rectangle fully under the curve (about 99% of the draws)
+                    if (fabs(z) < x[i + 1])
+                        return z;
+
+                    if (i == 0)
+                    {
+                        // Tail beyond x[1] (Marsaglia's method)
+                        real_t a, b;
+                        do {
+                            a = -log(rng.next_unit_open()) / x[1];
+                            b = -log(rng.next_unit_open());
+                        } while (b + b < a * a);
+                        return z < 0 ? -(x[1] + a) : x[1] + a;
+                    }
+
+                    // Wedge between the rectangle and the curve
+                    if (f[i] + rng.next_unit() * (f[i + 1] - f[i]) < exp(-0.5 * z * z))
+                        return z;
+
+                    bits = random_bits(rng);
+                }
+            }
         public:
             /// @brief Initializes the Gaussian distribution about location x = mu with standard deviation sigma
             /// @param mu mean of the distribution
@@ -173,7 +288,70 @@ namespace DiceForge {
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r1 A random real number uniformly distributed between 0 and 1
             /// @param r2 A random real number uniformly distributed between 0 and 1
-            real_t next(real_t r1, real_t r2);
+            real_t next(real_t r1, real_t r2) const;
+            /// @brief Returns the next value of the random variable described by the distribution (Ziggurat method)
+            /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+            template <typename G>
+            real_t next(G& rng) const
+            {
+                auto&& g = as_generator(rng);
+                return standard(g, random_bits(g)) * sigma + mu;
+            }
+            /// @brief Fills the given array with values of the random variable described by the distribution
+            /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+            /// @param out array to fill
+            /// @param n number of values to generate
+            /// @note The random bits are drawn in bulk through Generator::fill, so this is faster than calling next(rng) n times
+            template <typename G>
+            void sample(G& rng, real_t* out, size_t n) const
+            {
+                auto&& g = as_generator(rng);
+                typedef decltype(g.next()) T;
+                constexpr size_t block = 256;
+                constexpr size_t words = sizeof(T) >= sizeof(uint64_t) ? 1 : 2;
+                T raw[block * words];
+                const real_t* x = zig->x;
+
+                while (n > 0)
+                {
+                    size_t len = std::min(n, block);
+                    g.fill(raw, len * words);
+                    for (size_t k = 0; k < len; k++)
+                    {
+                        uint64_t bits;
+                        if constexpr (words == 1)
+                            bits = uint64_t(raw[k]);
+                        else
+                            bits = (uint64_t(raw[2 * k]) << 32) | uint64_t(raw[2 * k + 1]);
+
+                        // Fast path of standard(), the rejected draws are finished there
+                        int i = bits & 0xFF;
+                        real_t z = real_t(int64_t(bits) >> 11) * 0x1.0p-52 * x[i];
+                        if (fabs(z) >= x[i + 1])
+                            z = standard(g, bits);
+                        out[k] = z * sigma + mu;
+                    }
+                    out += len;
+                    n -= len;
+                }
+            }
+            /// @brief DiceForge::Gaussian::Sampler - Draws from the distribution by the Ziggurat method
+            class Sampler {
+                private:
+                    friend class Gaussian;
+                    const Gaussian* dist;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    real_t operator()(G& rng) const
+                    {
+                        return dist->next(rng);
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            /// @note The sampler refers to the distribution, which must outlive it
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             real_t variance() const override final;
             /// @brief Returns the theoretical expectation value of the distribution
@@ -218,7 +396,28 @@ namespace DiceForge {
             /// @param r1 A random real number uniformly distributed between 0 and 1
             /// @param r2 A random real number uniformly distributed between 0 and 1
             /// @param r3 A random real number uniformly distributed between 0 and 1
-            real_t next(real_t r1, real_t r2, real_t r3);
+            real_t next(real_t r1, real_t r2, real_t r3) const;
+            /// @brief DiceForge::Maxwell::Sampler - Draws from the distribution without rejection, as a times the square root
+            /// of a chi-squared variate with 3 degrees of freedom (an exponential variate plus the square of a normal one)
+            class Sampler {
+                private:
+                    friend class Maxwell;
+                    real_t scale; // -2 a^2
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    real_t operator()(G& rng) const
+                    {
+                        auto&& g = as_generator(rng);
+                        real_t c = cos(2 * M_PI * g.next_unit());
+                        real_t l1 = log(g.next_unit_open());
+                        real_t l2 = log(g.next_unit_open());
+                        return sqrt(scale * (l1 + l2 * c * c));
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             real_t variance() const override final;
             /// @brief Returns the theoretical expectation value of the distribution
@@ -259,8 +458,25 @@ namespace DiceForge {
         
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            real_t next(real_t r);
+            real_t next(real_t r) const;
         
+            /// @brief DiceForge::Weibull::Sampler - Draws from the distribution, with the inverse of the shape factor precomputed
+            class Sampler {
+                private:
+                    friend class Weibull;
+                    real_t lambda, inv_k;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    real_t operator()(G& rng) const
+                    {
+                        return lambda * pow(-log(as_generator(rng).next_unit_open()), inv_k);
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            Sampler prepare() const;
+
             /// @brief Returns the theoretical variance of the distribution
             /// @note The variation of a Weibull distribution is undefined
             /// @returns NaN
@@ -311,7 +527,23 @@ namespace DiceForge {
             Bernoulli(real_t p);
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            int_t next(real_t r);
+            int_t next(real_t r) const;
+            /// @brief DiceForge::Bernoulli::Sampler - Draws from the distribution without branching
+            class Sampler {
+                private:
+                    friend class Bernoulli;
+                    real_t p;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    int_t operator()(G& rng) const
+                    {
+                        return int_t(as_generator(rng).next_unit() <= p);
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             /// @returns p(1-p)
             real_t variance() const override final;
@@ -335,7 +567,12 @@ namespace DiceForge {
         private:
             uint_t n;
             real_t p;
-            std::vector<real_t> pmfs;
+            uint_t mode;            // floor((n + 1) p), where the inversion search starts
+            real_t pmf_mode;        // pmf at the mode
+            real_t cdf_mode;        // cdf at the mode
+            // Constants of the transformed rejection (BTRS) for s = min(p, 1 - p)
+            real_t s, spq, b, a, c, alpha, vr, urvr, lpq, h;
+            uint_t m;
         public:
             /// @brief Initializes the Binomial Distribution with (n, p)
             /// @param n number of trials 
@@ -344,7 +581,66 @@ namespace DiceForge {
             Binomial(uint_t n, real_t p);
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            int_t next(real_t r);
+            /// @note Inverts the cdf by searching outwards from the mode, which takes O(sqrt(n p (1 - p))) expected time
+            int_t next(real_t r) const;
+            /// @brief Returns the next value of the random variable described by the distribution
+            /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+            /// @note Takes O(1) expected time, using transformed rejection (Hormann's BTRS) when n min(p, 1 - p) >= 10
+            /// and inversion otherwise
+            template <typename G, std::enable_if_t<is_bit_generator<G>::value, int> = 0>
+            int_t next(G& rng) const
+            {
+                auto&& g = as_generator(rng);
+                if (n * s < 10)
+                    return next(g.next_unit());
+
+                for (;;)
+                {
+                    real_t u, v = g.next_unit();
+                    if (v <= urvr)
+                    {
+                        // Squeeze, accepted without evaluating the pmf
+                        u = v / vr - 0.43;
+                        return result(uint_t(floor((2 * a / (0.5 - fabs(u)) + b) * u + c)));
+                    }
+                    if (v >= vr)
+                    {
+                        u = g.next_unit() - 0.5;
+                    }
+                    else
+                    {
+                        u = v / vr - 0.93;
+                        u = (u < 0 ? -0.5 : 0.5) - u;
+                        v = g.next_unit() * vr;
+                    }
+
+                    real_t us = 0.5 - fabs(u);
+                    real_t k = floor((2 * a / us + b) * u + c);
+                    if (k < 0 || k > n)
+                        continue;
+
+                    v = v * alpha / (a / (us * us) + b);
+                    if (log(v) <= h - log_factorial(k) - log_factorial(n - k) + (k - m) * lpq)
+                        return result(uint_t(k));
+                }
+            }
+            /// @brief DiceForge::Binomial::Sampler - Draws from the distribution through its precomputed inversion and rejection constants
+            class Sampler {
+                private:
+                    friend class Binomial;
+                    const Binomial* dist;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    int_t operator()(G& rng) const
+                    {
+                        return dist->next(rng);
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            /// @note The sampler refers to the distribution, which must outlive it
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             real_t variance() const override final;
             /// @brief Returns the theoretical expectation value of the distribution
@@ -358,6 +654,12 @@ namespace DiceForge {
             real_t pmf(int_t k) const override final;
             /// @brief Cumulative distribution function of the Binomial distribution
             real_t cdf(int_t k) const override final;
+        private:
+            // Maps a sample drawn for s back to p
+            int_t result(uint_t k) const
+            {
+                return p <= 0.5 ? k : n - k;
+            }
     };
     
     /// @brief DiceForge::Gibbs - Gibbs distribution class (derived from Discrete)
@@ -371,6 +673,8 @@ namespace DiceForge {
         int_t *x_array = nullptr;
         // Length of all 3 arrays
         int_t n = 0;
+        // Alias table of pmf_array, for drawing samples
+        AliasTable table;
     public:
         /// @brief Constructor to initialise private attributes of the distribution
         template <typename RandomAccessIterator1, typename RandomAccessIterator2>
@@ -423,14 +727,36 @@ namespace DiceForge {
                 pmf_array[i] /= cdf_array[n - 1];
                 cdf_array[i] /= cdf_array[n - 1];
             }
+
+            table = AliasTable(pmf_array, pmf_array + n);
         }
         // Destructor to free memory used by the 3 array attributes
         ~Gibbs();
         
         /// @brief Returns a sample of the random variable following the distribution given a 'r'
         /// @param r a uniformly distributed unit random variable
-        int_t next(real_t r);
+        /// @note Inverse cdf by binary search, so r maps monotonically to the sample (for antithetic or quasi-random r).
+        /// The Sampler draws from an alias table in O(1) time instead
+        int_t next(real_t r) const;
         
+        /// @brief DiceForge::Gibbs::Sampler - Draws from the distribution through its alias table
+        class Sampler {
+            private:
+                friend class Gibbs;
+                const Gibbs* dist;
+            public:
+                /// @brief Returns the next value of the random variable described by the distribution
+                /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                template <typename G>
+                int_t operator()(G& rng) const
+                {
+                    return dist->x_array[dist->table.index(as_generator(rng).next_unit())];
+                }
+        };
+        /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+        /// @note The sampler refers to the tables of the distribution, which must outlive it
+        Sampler prepare() const;
+
         /// @brief Returns the theoretical variance of the distribution
         real_t variance() const override;
         
@@ -455,8 +781,8 @@ namespace DiceForge {
     /// replacement from an urn with two colors. n is the number of balls you take,
     /// K is the number of red balls in the urn, N is the total number of balls in
     /// the urn, and the return value is the number of red balls you get.
-    /// To regenerate samples of the variation this class uses inversion by chop-down
-    /// search from start when parameters are small
+    /// To regenerate samples of the variation this class uses inversion by binary
+    /// search of a table of the cdf
     class Hypergeometric : public Discrete
     {
     private:
@@ -476,7 +802,24 @@ namespace DiceForge {
         Hypergeometric(int32_t N, int32_t K, int32_t n); 
         /// @brief Returns the next value of the random variable described by the distribution
         /// @param r A random real number uniformly distributed between 0 and 1
-        int_t next(real_t r);        
+        int_t next(real_t r) const;        
+        /// @brief DiceForge::Hypergeometric::Sampler - Draws from the distribution by binary search of its cdf table
+        class Sampler {
+            private:
+                friend class Hypergeometric;
+                const Hypergeometric* dist;
+            public:
+                /// @brief Returns the next value of the random variable described by the distribution
+                /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                template <typename G>
+                int_t operator()(G& rng) const
+                {
+                    return dist->next(as_generator(rng).next_unit());
+                }
+        };
+        /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+        /// @note The sampler refers to the tables of the distribution, which must outlive it
+        Sampler prepare() const;
         /// @brief Returns the theoretical variance of the distribution
         real_t variance() const override;
         /// @brief Returns the theoretical expectation value of the distribution
@@ -496,6 +839,7 @@ namespace DiceForge {
         private:
             uint_t N, K, r;
             real_t* pmfs;
+            std::vector<real_t> cumulative; // cdf at 0..K
         public:
             /// @brief Initializes the Negative Hypergeometric Distribution with (N, K, r)
             /// @param N size of the population 
@@ -507,7 +851,24 @@ namespace DiceForge {
             ~NegHypergeometric();
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            int_t next(real_t r);
+            int_t next(real_t r) const;
+            /// @brief DiceForge::NegHypergeometric::Sampler - Draws from the distribution by binary search of its cdf table
+            class Sampler {
+                private:
+                    friend class NegHypergeometric;
+                    const NegHypergeometric* dist;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    int_t operator()(G& rng) const
+                    {
+                        return dist->next(as_generator(rng).next_unit());
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            /// @note The sampler refers to the tables of the distribution, which must outlive it
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             real_t variance() const override final;
             /// @brief Returns the theoretical expectation value of the distribution
@@ -527,30 +888,113 @@ namespace DiceForge {
     /// @brief DiceForge::Poisson - A discrete probability distribution
     class Poisson : public Discrete {
         private:
-            real_t l,sq,lnl,g;
+            real_t l;
+            // Below this lambda samples are drawn by inverting a table of the cdf, above it by PTRS
+            static constexpr real_t inversion_limit = 10;
+            // Table of the cdf for small lambda, with a guide table pointing into it
+            static constexpr int table_size = 64;
+            static constexpr int guide_size = 32;
+            real_t cdf_table[table_size];
+            int guide[guide_size];
+            // Constants of the transformed rejection (PTRS) for large lambda
+            real_t slam, loglam, b, a, invalpha, vr;
+
+            // Smallest k with cdf(k) > u, for small lambda
+            int_t invert(real_t u) const
+            {
+                int_t k = guide[int(u * guide_size)];
+                while (cdf_table[k] <= u)
+                    k++;
+                return k;
+            }
+
+            // Transformed rejection with squeeze (Hormann, 1993), the first attempt uses the given uniforms
+            template <typename G>
+            int_t ptrs(G& rng, real_t u, real_t v) const
+            {
+                for (;;)
+                {
+                    u -= 0.5;
+                    real_t us = 0.5 - fabs(u);
+                    real_t k = floor((2 * a / us + b) * u + l + 0.43);
+                    if (us >= 0.07 && v <= vr)
+                        return int_t(k);
+                    if (k >= 0 && (us >= 0.013 || v <= us) &&
+                        log(v * invalpha / (a / (us * us) + b)) <= -l + k * loglam - log_factorial(k))
+                        return int_t(k);
+
+                    u = rng.next_unit();
+                    v = rng.next_unit();
+                }
+            }
         public:
             /// @brief Constructor for the Poisson Distribution
             /// @param lambda lambda (> 0)
             Poisson(real_t lambda);
 
             /// @brief Returns the next value of the random variable described by the distribution
-            /// @param rng A random number generator (derived from DiceForge::Generator) 
-            template <typename T>
-            int_t next(DiceForge::Generator<T>& rng)
+            /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937) 
+            /// @note Takes O(1) expected time, by table inversion for lambda < 10 and transformed rejection (Hormann's PTRS) otherwise
+            template <typename G>
+            int_t next(G& rng) const
+            {
+                auto&& g = as_generator(rng);
+                real_t u = g.next_unit();
+                if (l < inversion_limit)
+                    return invert(u);
+                real_t v = g.next_unit();
+                return ptrs(g, u, v);
+            }
+
+            /// @brief Fills the given array with values of the random variable described by the distribution
+            /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+            /// @param out array to fill
+            /// @param n number of values to generate
+            /// @note The uniform random numbers are drawn in bulk through Generator::fill_unit
+            template <typename G>
+            void sample_n(G& rng, int_t* out, size_t n) const
             {
-                real_t t,x,c;
-                do{
-                    do{
-                        t=tan(M_PI*rng.next_unit());
-                        x=sq*t+l;
-                    } while (x<0);
-                    x=floor(x);
-                    c=0.9*(1+t*t)*exp(x*lnl-lgamma(x+1)-g);
-                } while(rng.next_unit()>c);
-
-                return int_t(x);
+                auto&& g = as_generator(rng);
+                constexpr size_t block = 256;
+                real_t u[2 * block];
+                while (n > 0)
+                {
+                    size_t len = std::min(n, block);
+                    if (l < inversion_limit)
+                    {
+                        g.fill_unit(u, len);
+                        for (size_t k = 0; k < len; k++)
+                            out[k] = invert(u[k]);
+                    }
+                    else
+                    {
+                        g.fill_unit(u, 2 * len);
+                        for (size_t k = 0; k < len; k++)
+                            out[k] = ptrs(g, u[2 * k], u[2 * k + 1]);
+                    }
+                    out += len;
+                    n -= len;
+                }
             }
 
+            /// @brief DiceForge::Poisson::Sampler - Draws from the distribution through its cdf table or its rejection constants
+            class Sampler {
+                private:
+                    friend class Poisson;
+                    const Poisson* dist;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    int_t operator()(G& rng) const
+                    {
+                        return dist->next(rng);
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            /// @note The sampler refers to the distribution, which must outlive it
+            Sampler prepare() const;
+
             /// @brief Returns the theoretical variance of the distribution
             real_t variance() const override;
 
@@ -582,7 +1026,23 @@ namespace DiceForge {
             Geometric(real_t p);
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            int_t next(real_t r);            
+            int_t next(real_t r) const;            
+            /// @brief DiceForge::Geometric::Sampler - Draws from the distribution without branching, with 1 / log(1 - p) precomputed
+            class Sampler {
+                private:
+                    friend class Geometric;
+                    real_t inv_log_q;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    int_t operator()(G& rng) const
+                    {
+                        return int_t(floor(log(as_generator(rng).next_unit_open()) * inv_log_q)) + 1;
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             /// @returns (1-p)/(p^2)
             real_t variance() const override;
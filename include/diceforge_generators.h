@@ -7,19 +7,23 @@ namespace DiceForge
 {
     /// @brief DiceForge::BlumBlumShub32 - A RNG utilizing the Blum-Blum-Shub algorithm
     /// for generating 32-bit unsigned random integers
+    /// @note The modulus n = p * q is handled with Montgomery arithmetic, and the lowest
+    /// log2(log2(n)) bits of the state are extracted per squaring by default
     class BlumBlumShub32 : public Generator<uint32_t>
     {
         private:
-            static const uint64_t p;
-            static const uint64_t q;
-            static const uint64_t n;
-
-            BigInt128 state; // Internal state
+            Montgomery modulus; // Montgomery context of the modulus n = p * q
+            uint64_t state[Montgomery::max_limbs]; // Internal state, in Montgomery form
+            int bits; // Number of bits extracted per squaring
+            uint64_t mask; // Mask of the extracted bits
+            uint64_t pool; // Extracted bits not returned yet
+            int pool_bits; // Number of bits in pool
 
             /**
              * @brief propagate - Advances the internal state using the Blum-Blum-Shub algorithm
+             * @return The extracted bits of the new state
              */
-            inline void propagate();
+            inline uint64_t propagate();
 
             /// @brief generate - Generates a random number using the Blum-Blum-Shub algorithm
             /// @return The generated random number
@@ -30,31 +34,51 @@ namespace DiceForge
             /// @note if the seed is zero then a non-zero seed is adopted by default
             void reseed(uint32_t seed) override;
 
+            /// @brief generate_block - Generates n random numbers using the Blum-Blum-Shub algorithm
+            /// @param out The buffer to write the generated numbers to
+            /// @param n The number of random numbers to generate
+            void generate_block(uint32_t* out, size_t n) override;
+
         public:
             /// @brief Constructor for BlumBlumShub32
             /// @param seed The initial seed value
             /// @note if the seed is zero then a non-zero seed is adopted by default
             BlumBlumShub32(uint32_t seed);
 
+            /// @brief Constructor for BlumBlumShub32 with a custom modulus
+            /// @param seed The initial seed value
+            /// @param p First prime factor of the modulus, as 64-bit limbs (least significant first)
+            /// @param q Second prime factor of the modulus, as 64-bit limbs (least significant first)
+            /// @param bits Number of bits extracted per squaring (1 to 32), zero for log2(log2(n))
+            /// @throws std::invalid_argument if p or q is not 3 mod 4, if p = q, if n = p * q exceeds 512 bits
+            /// or if bits is out of range
+            /// @note p and q are not tested for primality, extracting more than log2(log2(n)) bits
+            /// per squaring trades the security of the generator for speed
+            BlumBlumShub32(uint32_t seed, const std::vector<uint64_t>& p, const std::vector<uint64_t>& q, int bits = 0);
+
             /// @brief Destructor for BlumBlumShub32
             ~BlumBlumShub32() = default;
     };
 
     /// @brief DiceForge::BlumBlumShub64 - A RNG utilizing the Blum-Blum-Shub algorithm
     /// for generating 64-bit unsigned random integers
+    /// @note The modulus n = p * q is handled with Montgomery arithmetic, and the lowest
+    /// log2(log2(n)) bits of the state are extracted per squaring by default
     class BlumBlumShub64 : public Generator<uint64_t>
     {
         private:
-            static const uint64_t p;
-            static const uint64_t q;
-            static const uint64_t n;
-
-            BigInt128 state; // Internal state
+            Montgomery modulus; // Montgomery context of the modulus n = p * q
+            uint64_t state[Montgomery::max_limbs]; // Internal state, in Montgomery form
+            int bits; // Number of bits extracted per squaring
+            uint64_t mask; // Mask of the extracted bits
+            uint128_t pool; // Extracted bits not returned yet
+            int pool_bits; // Number of bits in pool
 
             /**
              * @brief propagate - Advances the internal state using the Blum-Blum-Shub algorithm
+             * @return The extracted bits of the new state
              */
-            inline void propagate();
+            inline uint64_t propagate();
 
             /// @brief generate - Generates a random number using the Blum-Blum-Shub algorithm
             /// @return The generated random number
@@ -65,13 +89,29 @@ namespace DiceForge
             /// @note if the seed is zero then a non-zero seed is adopted by default
             void reseed(uint64_t seed) override;
 
+            /// @brief generate_block - Generates n random numbers using the Blum-Blum-Shub algorithm
+            /// @param out The buffer to write the generated numbers to
+            /// @param n The number of random numbers to generate
+            void generate_block(uint64_t* out, size_t n) override;
+
         public:
             /// @brief Constructor for BlumBlumShub64
             /// @param seed The initial seed value
             /// @note if the seed is zero then a non-zero seed is adopted by default
             BlumBlumShub64(uint64_t seed);
 
-            /// @brief Destructor for BlumBlumShub64            
+            /// @brief Constructor for BlumBlumShub64 with a custom modulus
+            /// @param seed The initial seed value
+            /// @param p First prime factor of the modulus, as 64-bit limbs (least significant first)
+            /// @param q Second prime factor of the modulus, as 64-bit limbs (least significant first)
+            /// @param bits Number of bits extracted per squaring (1 to 32), zero for log2(log2(n))
+            /// @throws std::invalid_argument if p or q is not 3 mod 4, if p = q, if n = p * q exceeds 512 bits
+            /// or if bits is out of range
+            /// @note p and q are not tested for primality, extracting more than log2(log2(n)) bits
+            /// per squaring trades the security of the generator for speed
+            BlumBlumShub64(uint64_t seed, const std::vector<uint64_t>& p, const std::vector<uint64_t>& q, int bits = 0);
+
+            /// @brief Destructor for BlumBlumShub64
             ~BlumBlumShub64() = default;
     };
 
@@ -85,6 +125,8 @@ namespace DiceForge
         uint64_t generate() override;
         // Function to reseed the RNG
         void reseed(uint64_t seed) override;
+        // Function to generate n random 64-bit positive integers at once
+        void generate_block(uint64_t* out, size_t n) override;
     public:
         /// @brief Initializes the LFSR with the specified seed
         /// @param seed seed to initialize the RNG with
@@ -105,6 +147,8 @@ namespace DiceForge
         /// @brief Function to reseed the RNG
         /// @note if the seed provided is zero, then the current system time is taken as seed
         void reseed(uint32_t seed) override;
+        // Function to generate n random 32-bit positive integers at once
+        void generate_block(uint32_t* out, size_t n) override;
     public:    
         /// @brief Initializes the LFSR with the specified seed
         /// @param seed seed to initialize the RNG with
@@ -119,19 +163,20 @@ namespace DiceForge
     {
     private:
         // Main Parameters:
-        int N;                          // length of state value vector
-        int M;                          // optimum value as mid
-        uint32_t A;                     // vector in the matrix A
-        uint32_t upperbits, lowerbits;  // for obtaining first w-r bits of the number
+        static constexpr int N = 624;                       // length of state value vector
+        static constexpr int M = 397;                       // optimum value as mid
+        static constexpr uint32_t A = 2573724191;           // vector in the matrix A
+        static constexpr uint32_t upperbits = 0x80000000;   // for obtaining first w-r bits of the number
+        static constexpr uint32_t lowerbits = 0xFFFFFFFF;   // (int32_t)0x7ffffffff, kept as is so that streams do not change
         // Tempering Parameters:
-        uint32_t tempering_mask_B;
-        uint32_t tempering_mask_C;
-        uint32_t tempering_shift_U;
-        uint32_t tempering_shift_S;
-        uint32_t tempering_shift_T;
-        uint32_t tempering_shift_L;
+        static constexpr uint32_t tempering_mask_B = 0x9d2c5680;
+        static constexpr uint32_t tempering_mask_C = 0xefc60000;
+        static constexpr uint32_t tempering_shift_U = 11;
+        static constexpr uint32_t tempering_shift_S = 7;
+        static constexpr uint32_t tempering_shift_T = 15;
+        static constexpr uint32_t tempering_shift_L = 18;
         // Other Parameters:
-        std::vector<uint32_t> mt;       // State Vector
+        alignas(32) uint32_t mt[N];     // State Vector
         int mti;                // Used as index for the array MT.
         uint32_t seed;                  // Seed given from main
         // Functions to generate first N pseudo-random numbers as a seed for the algorithm.
@@ -140,6 +185,7 @@ namespace DiceForge
         uint32_t temper(uint32_t);
         uint32_t generate() override;
         void reseed(uint32_t seed) override;
+        void generate_block(uint32_t* out, size_t n) override;
     public:
         /// @brief Initializes the Mersenne Twister RNG with the specified seed
         /// @param seed seed to initialize the RNG with
@@ -153,19 +199,20 @@ namespace DiceForge
     {
     private:
         // Main Parameters:
-        int N;                          // length of state value vector
-        int M;                          // optimum value as mid
-        uint64_t A;                     // vector in the matrix A
-        uint64_t upperbits, lowerbits;  // for obtaining first w-r bits of the number
+        static constexpr int N = 312;                                   // length of state value vector
+        static constexpr int M = 156;                                   // optimum value as mid
+        static constexpr uint64_t A = 0xB5026F5AA96619E9;               // vector in the matrix A
+        static constexpr uint64_t upperbits = 0xFFFFFFFF80000000ULL;    // for obtaining first w-r bits of the number
+        static constexpr uint64_t lowerbits = 0x7FFFFFFFULL;
         // Tempering Parameters:
-        uint64_t tempering_mask_B;
-        uint64_t tempering_mask_C;
-        uint64_t tempering_shift_U;
-        uint64_t tempering_shift_S;
-        uint64_t tempering_shift_T;
-        uint64_t tempering_shift_L;
+        static constexpr uint64_t tempering_mask_B = 0xD66B5EF5B4DA0000;
+        static constexpr uint64_t tempering_mask_C = 0xFDED6BE000000000;
+        static constexpr uint64_t tempering_shift_U = 29;
+        static constexpr uint64_t tempering_shift_S = 17;
+        static constexpr uint64_t tempering_shift_T = 37;
+        static constexpr uint64_t tempering_shift_L = 41;
         // Other Parameters:
-        std::vector<uint64_t> mt;       // State Vector
+        alignas(32) uint64_t mt[N];     // State Vector
         int mti;                // Used as index for the array MT.
         uint64_t seed;                  // Seed given from main
         // Functions to generate first N pseudo-random numbers as a seed for the algorithm.
@@ -174,12 +221,22 @@ namespace DiceForge
         uint64_t temper(uint64_t);
         uint64_t generate() override;
         void reseed(uint64_t seed) override;
+        void generate_block(uint64_t* out, size_t n) override;
+        // Replaces the state by g(T) applied to it, T being the one-word step of the recurrence
+        void jump_window(const std::vector<uint64_t>& g, size_t terms);
     public:
         /// @brief Initializes the Mersenne Twister RNG with the specified seed
         /// @param seed seed to initialize the RNG with
         /// @note if the seed provided is zero, then the current system time is taken as seed
         MT64(uint64_t seed);
         ~MT64() = default;
+        /// @brief Advances the RNG by n steps, as if next() had been called n times
+        /// @param n number of steps to skip
+        /// @note Works in O(log n) polynomial operations, no numbers are generated and discarded
+        void jump(uint64_t n);
+        /// @brief Advances the RNG by 2^128 steps
+        /// @note Repeated long jumps from one seed split it into non-overlapping substreams of 2^128 numbers each
+        void long_jump();
     };
             
     /// @brief DiceForge::NaorReingold - An implementation of the Naor-Reingold PRF 
@@ -188,8 +245,10 @@ namespace DiceForge
     {
     private:
         uint64_t m_state;   // Internal state
+        uint32_t m_product;  // Output for the current state
         uint32_t generate() override;
-        void reseed(uint32_t seed) override;        
+        void reseed(uint32_t seed) override;
+        void generate_block(uint32_t* out, size_t n) override;
     public:
         /// @brief Initializes the PRF with the given seed
         /// @param seed seed to initialize the PRF with
@@ -198,6 +257,42 @@ namespace DiceForge
         NaorReingold(uint32_t seed);
         /// @brief Default destructor
         ~NaorReingold() = default;
+        /// @brief Evaluates the PRF at the given point, irrespective of the state of the generator
+        /// @param x point to evaluate the PRF at
+        /// @return The number the generator returns when its state is x
+        uint32_t evaluate(uint64_t x) const;
+    };
+
+    /// @brief DiceForge::Philox4x32 - A counter-based RNG following the Philox4x32-10 algorithm (Salmon et al.)
+    /// Each 128-bit counter is encrypted independently with the key into two 64-bit numbers,
+    /// so any position of the stream can be reached directly by setting the counter
+    /// @note Generates 64-bit unsigned integers
+    class Philox4x32 : public Generator<uint64_t>
+    {
+    private:
+        uint32_t m_key[2];          // Key of the bijection
+        uint64_t m_counter[2];      // Counter of the next block (low word, high word)
+        uint64_t m_buffer[2];       // Output of the current block
+        int m_index;                // Index of the next number in m_buffer (2 when it is used up)
+        uint64_t generate() override;
+        void reseed(uint64_t seed) override;
+        void generate_block(uint64_t* out, size_t n) override;
+    public:
+        /// @brief Initializes the Philox RNG with the specified seed as key and the counter at zero
+        /// @param seed seed to initialize the RNG with
+        /// @note If the given seed is zero, then the current system time is used as the seed
+        Philox4x32(uint64_t seed);
+        /// @brief Default destructor
+        ~Philox4x32() = default;
+        /// @brief Sets the key, the stream restarts from the current counter
+        /// @param key 64-bit key, every key gives an independent stream
+        void set_key(uint64_t key);
+        /// @brief Sets the 128-bit counter of the next block
+        /// @param lo lower 64 bits of the counter
+        /// @param hi upper 64 bits of the counter
+        /// @note Block i produces numbers 2i and 2i + 1 of the stream, so after set_counter(i) the next number
+        /// is number 2i of the stream, irrespective of what was generated before
+        void set_counter(uint64_t lo, uint64_t hi = 0);
     };
 
     /// @brief DiceForge::XORShift32 - A PRNG following the XORShift* algorithm
@@ -210,6 +305,7 @@ namespace DiceForge
         uint32_t m_state;   // Internal state
         uint32_t generate() override;
         void reseed(uint32_t seed) override;
+        void generate_block(uint32_t* out, size_t n) override;
     public:
         /// @brief Initializes the XOR Shift RNG with the specified seed
         /// @param seed must be a non-zero number
@@ -229,6 +325,7 @@ namespace DiceForge
         uint64_t m_state;   // Internal state
         uint64_t generate() override;
         void reseed(uint64_t seed) override;
+        void generate_block(uint64_t* out, size_t n) override;
     public:
         /// @brief Initializes the XOR Shift RNG with the specified seed
         /// @param seed must be a non-zero number
@@ -236,6 +333,109 @@ namespace DiceForge
         XORShift64(uint64_t seed);
         /// @brief Default destructor
         ~XORShift64() = default;
+        /// @brief Advances the RNG by n steps, as if next() had been called n times
+        /// @param n number of steps to skip
+        /// @note Works in O(log n) 64x64 bit matrix operations, no numbers are generated and discarded
+        void jump(uint64_t n);
+        /// @brief Advances the RNG by 2^48 steps
+        /// @note Repeated long jumps from one seed split it into 2^16 non-overlapping substreams of 2^48 numbers each
+        void long_jump();
+    };
+
+    /// @brief DiceForge::StaticXORShift32 - The XORShift32 PRNG behind the static interface (DiceForge::StaticGenerator)
+    /// @note Generates the same numbers as XORShift32 from the same seed, but its calls can be inlined into the caller
+    class StaticXORShift32 : public StaticGenerator<uint32_t, StaticXORShift32>
+    {
+    private:
+        friend class StaticGenerator<uint32_t, StaticXORShift32>;
+        uint32_t m_state;   // Internal state
+        uint32_t generate()
+        {
+            m_state ^= m_state << 13;
+            m_state ^= m_state >> 17;
+            m_state ^= m_state << 5;
+            return m_state * 0x2545F4914F6CDD1DULL;
+        }
+    public:
+        /// @brief Initializes the XOR Shift RNG with the specified seed
+        /// @param seed must be a non-zero number
+        /// @note If the given seed is zero, then the current system is used as the seed
+        StaticXORShift32(uint32_t seed);
+        /// @brief Re-initializes the RNG with specified seed
+        /// @param seed seed provided for initialization
+        void reset_seed(uint32_t seed);
+    };
+
+    /// @brief DiceForge::StaticXORShift64 - The XORShift64 PRNG behind the static interface (DiceForge::StaticGenerator)
+    /// @note Generates the same numbers as XORShift64 from the same seed, but its calls can be inlined into the caller
+    class StaticXORShift64 : public StaticGenerator<uint64_t, StaticXORShift64>
+    {
+    private:
+        friend class StaticGenerator<uint64_t, StaticXORShift64>;
+        uint64_t m_state;   // Internal state
+        uint64_t generate()
+        {
+            m_state ^= m_state << 13;
+            m_state ^= m_state >> 7;
+            m_state ^= m_state << 17;
+            return m_state * 0x2545F4914F6CDD1DULL;
+        }
+    public:
+        /// @brief Initializes the XOR Shift RNG with the specified seed
+        /// @param seed must be a non-zero number
+        /// @note If the given seed is zero, then the current system is used as the seed
+        StaticXORShift64(uint64_t seed);
+        /// @brief Re-initializes the RNG with specified seed
+        /// @param seed seed provided for initialization
+        void reset_seed(uint64_t seed);
+    };
+
+    /// @brief DiceForge::Sobol - Sobol low-discrepancy sequence, with the direction numbers of Joe and Kuo
+    /// (new-joe-kuo-6.21201, which have good two-dimensional projections)
+    /// Consecutive points differ in one direction number per coordinate (gray code order), so each takes O(d) time
+    /// @note Holds up to 2^32 points of up to max_dimension coordinates, each point in (0, 1)^d as the
+    /// coordinates are centred in their cell of width 2^-32
+    class Sobol : public QuasiGenerator
+    {
+    private:
+        std::vector<uint32_t> m_direction;  // 32 direction numbers of every coordinate
+        std::vector<uint32_t> m_state;      // Coordinates of the next point, before scrambling
+        std::vector<uint32_t> m_scramble;   // Random shift or seed of the scrambling of every coordinate
+        Scrambling m_scrambling;
+        void generate(real_t* point) override;
+        void seek(uint64_t i) override;
+    public:
+        /// @brief Largest number of coordinates for which direction numbers are embedded
+        static constexpr size_t max_dimension = 1024;
+        /// @brief Initializes the Sobol sequence at its first point
+        /// @param dimension number of coordinates of every point, at most max_dimension
+        /// @param scrambling Scrambling::none, Scrambling::shift (random digital shift) or Scrambling::owen
+        /// (hash-based nested uniform scrambling of Laine and Karras)
+        /// @param seed seed of the scrambling, if it is zero the current system time is used (not used without scrambling)
+        Sobol(size_t dimension, Scrambling scrambling = Scrambling::none, uint64_t seed = 0);
+        /// @brief Default destructor
+        ~Sobol() = default;
+    };
+
+    /// @brief DiceForge::Halton - Halton low-discrepancy sequence, coordinate d being the radical inverse
+    /// of the index of the point in the d-th prime base
+    /// @note Starts from index one, so every point is in (0, 1)^d. Any point is computed directly from its index,
+    /// in O(d log n) time. Its projections on pairs of coordinates of large bases are poor, which scrambling mends
+    class Halton : public QuasiGenerator
+    {
+    private:
+        std::vector<uint32_t> m_base;                       // Prime base of every coordinate
+        std::vector<std::vector<uint32_t>> m_permutation;   // Permutation of the digits of every coordinate, empty without scrambling
+        void generate(real_t* point) override;
+        void seek(uint64_t i) override;
+    public:
+        /// @brief Initializes the Halton sequence at its first point
+        /// @param dimension number of coordinates of every point
+        /// @param scrambling Scrambling::none or Scrambling::shift (a random permutation of the non-zero digits of every base)
+        /// @param seed seed of the scrambling, if it is zero the current system time is used (not used without scrambling)
+        Halton(size_t dimension, Scrambling scrambling = Scrambling::none, uint64_t seed = 0);
+        /// @brief Default destructor
+        ~Halton() = default;
     };
 
     // Typedefs for convenience
@@ -244,7 +444,9 @@ namespace DiceForge
     typedef LFSR64 LFSR;
     typedef MT64 MT;
     typedef NaorReingold NaorReingold32;
+    typedef Philox4x32 Philox;
     typedef XORShift64 XORShift;
+    typedef StaticXORShift64 StaticXORShift;
 
     /// @brief The default random number generator of DiceForge; can be used as it is
     static XORShift64 Random(0);
@@ -0,0 +1,151 @@
+#ifndef DF_MONTECARLO_H
+#define DF_MONTECARLO_H
+
+#include <vector>
+#include <functional>
+
+#include "diceforge_core.h"
+#include "diceforge_parallel.h"
+
+namespace DiceForge
+{
+    /// @brief DiceForge::RunningStats - Running mean and variance of a stream of numbers
+    /// @note Welford's update for every number and Chan et al.'s formula for merging two accumulators,
+    /// which are both stable where the textbook sum of squares loses its precision
+    class RunningStats
+    {
+    public:
+        /// @brief Constructs an accumulator of no numbers
+        RunningStats() = default;
+
+        /// @brief Adds a number
+        void add(real_t x)
+        {
+            n++;
+            real_t delta = x - m;
+            m += delta / n;
+            s += delta * (x - m);
+        }
+
+        /// @brief Adds the numbers of another accumulator
+        void merge(const RunningStats& other);
+        /// @brief Returns the number of numbers added
+        uint64_t count() const;
+        /// @brief Returns the mean of the numbers
+        real_t mean() const;
+        /// @brief Returns the (unbiased) sample variance of the numbers, zero for fewer than two
+        real_t variance() const;
+        /// @brief Returns the standard error of the mean, sqrt(variance / count)
+        real_t std_error() const;
+
+    private:
+        uint64_t n = 0;     // Count
+        real_t m = 0;       // Mean
+        real_t s = 0;       // Sum of squared deviations from the mean
+    };
+
+    /// @brief Result of a Monte Carlo integration
+    struct IntegrationResult
+    {
+        real_t value;       // Estimate of the integral
+        real_t std_error;   // Standard error of the estimate
+        uint64_t samples;   // Number of points sampled
+        bool converged;     // Whether the standard error reached the target before the maximum number of points
+    };
+
+    /// @brief Number of points sampled by one task of monte_carlo_integrate
+    constexpr size_t integration_block_size = 1 << 14;
+
+    /// @brief Estimates the integral of f over a box by Monte Carlo, sampling in parallel until the standard error reaches the target
+    /// @param f integrand, taking the coordinates of a point as a std::vector<real_t>
+    /// @param lower lower corner of the box
+    /// @param upper upper corner of the box
+    /// @param target_error standard error at which sampling stops
+    /// @param max_samples largest number of points to sample
+    /// @param seed seed of the substreams, if it is zero the current system time is used
+    /// @param threads number of threads, zero for as many as the hardware runs concurrently
+    /// @note Points are sampled in blocks of integration_block_size, block b from substream(seed, b), and the mean and variance
+    /// of the blocks are merged in order, so the result only depends on the seed, not on the number of threads. After every round
+    /// of blocks the number of points still needed is predicted from the variance so far.
+    /// The integrand is called from several threads at once, so it must not modify shared state
+    template <typename F>
+    IntegrationResult monte_carlo_integrate(F f, const std::vector<real_t>& lower, const std::vector<real_t>& upper,
+                                            real_t target_error, uint64_t max_samples, uint64_t seed, unsigned threads = 0)
+    {
+        if (lower.size() != upper.size() || lower.empty()){
+            throw std::invalid_argument("Corners of the box must have the same non-zero number of coordinates!");
+        }
+        if (max_samples < 2){
+            throw std::invalid_argument("At least two points must be sampled!");
+        }
+
+        size_t dims = lower.size();
+        real_t volume = 1;
+        for (size_t d = 0; d < dims; d++)
+            volume *= upper[d] - lower[d];
+
+        seed = parallel_seed(seed);
+        const size_t chunk = 256;
+        uint64_t max_blocks = (max_samples + integration_block_size - 1) / integration_block_size;
+        uint64_t done = 0;
+        uint64_t round = std::min<uint64_t>(16, max_blocks);
+        RunningStats total;
+        bool converged = false;
+
+        while (round > 0)
+        {
+            std::vector<RunningStats> stats(round);
+            parallel_for(round, threads, [&](size_t i) {
+                uint64_t b = done + i;
+                Philox4x32 rng = substream(seed, b);
+                uint64_t points = std::min<uint64_t>(integration_block_size, max_samples - b * integration_block_size);
+                std::vector<real_t> u(dims * chunk), x(dims);
+                for (uint64_t k = 0; k < points; k += chunk)
+                {
+                    size_t m = size_t(std::min<uint64_t>(chunk, points - k));
+                    rng.fill_unit(u.data(), dims * m);
+                    for (size_t p = 0; p < m; p++) {
+                        for (size_t d = 0; d < dims; d++)
+                            x[d] = lower[d] + (upper[d] - lower[d]) * u[p * dims + d];
+                        stats[i].add(f(x));
+                    }
+                }
+            });
+            for (auto& s : stats)
+                total.merge(s);
+            done += round;
+
+            real_t error = std::abs(volume) * total.std_error();
+            if (error <= target_error) {
+                converged = true;
+                break;
+            }
+
+            // Blocks needed for the target error if the variance stays as it is
+            real_t needed = volume * volume * total.variance() / (target_error * target_error) / integration_block_size;
+            real_t more = std::ceil(needed) - real_t(done);
+            uint64_t left = max_blocks - done;
+            round = std::min<uint64_t>(left, more < 1 ? 1 : (more < real_t(left) ? uint64_t(more) : left));
+        }
+
+        return {volume * total.mean(), std::abs(volume) * total.std_error(), total.count(), converged};
+    }
+
+    /// @brief Estimates the integral of f over [a, b] by Monte Carlo, sampling in parallel until the standard error reaches the target
+    /// @param f integrand, a function of one real variable
+    /// @param a lower limit
+    /// @param b upper limit
+    /// @param target_error standard error at which sampling stops
+    /// @param max_samples largest number of points to sample
+    /// @param seed seed of the substreams, if it is zero the current system time is used
+    /// @param threads number of threads, zero for as many as the hardware runs concurrently
+    template <typename F>
+    IntegrationResult monte_carlo_integrate(F f, real_t a, real_t b, real_t target_error, uint64_t max_samples,
+                                            uint64_t seed, unsigned threads = 0)
+    {
+        return monte_carlo_integrate([&f](const std::vector<real_t>& x) { return f(x[0]); },
+                                     std::vector<real_t>(1, a), std::vector<real_t>(1, b), target_error, max_samples, seed, threads);
+    }
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef DF_BigInt128_H
 #define DF_BigInt128_H
 
+#include <stdexcept>
+
 #include "types.h"
 
 namespace DiceForge{
@@ -84,6 +86,161 @@ namespace DiceForge{
             }
         }
     };
+
+    /**
+     * @brief A struct for modular arithmetic with an odd modulus of up to 512 bits.
+     * 
+     * Numbers are stored as little-endian arrays of 64-bit limbs. Products are reduced
+     * with Montgomery multiplication on native 128-bit products, so that no division is
+     * needed. A number a is represented in Montgomery form as aR mod n, with R = 2^(64 * limbs).
+     */
+    struct Montgomery {
+        static const int max_limbs = 8; /**< Maximum number of 64-bit limbs of the modulus. */
+        int limbs; /**< Number of 64-bit limbs of the modulus. */
+        uint64_t n[max_limbs]; /**< The modulus. */
+        uint64_t n_inv; /**< -n^(-1) mod 2^64. */
+        uint64_t r2[max_limbs]; /**< R^2 mod n, used for converting numbers into Montgomery form. */
+
+        /**
+         * @brief Constructs the Montgomery context of the given modulus.
+         * 
+         * @param modulus The limbs of the modulus, least significant first.
+         * @param size The number of limbs.
+         * @throws std::invalid_argument if the modulus is even, smaller than 3 or longer than max_limbs limbs.
+         */
+        Montgomery(const uint64_t* modulus, int size) {
+            while (size > 0 && modulus[size - 1] == 0)
+                size--;
+            if (size == 0 || size > max_limbs || (modulus[0] & 1) == 0 || (size == 1 && modulus[0] < 3))
+                throw std::invalid_argument("Montgomery modulus must be odd, at least 3 and at most 512 bits long!");
+
+            limbs = size;
+            for (int i = 0; i < max_limbs; i++)
+                n[i] = i < size ? modulus[i] : 0;
+
+            // Newton's iteration doubles the number of correct bits of n^(-1) mod 2^64 every step
+            uint64_t inv = n[0];
+            for (int i = 0; i < 5; i++)
+                inv *= 2 - n[0] * inv;
+            n_inv = 0 - inv;
+
+            // R^2 mod n by doubling 1 modulo n, 2 * 64 * limbs times
+            for (int i = 0; i < max_limbs; i++)
+                r2[i] = 0;
+            r2[0] = 1;
+            for (int k = 0; k < 128 * limbs; k++) {
+                uint64_t carry = 0;
+                for (int i = 0; i < limbs; i++) {
+                    uint64_t top = r2[i] >> 63;
+                    r2[i] = (r2[i] << 1) | carry;
+                    carry = top;
+                }
+                if (carry || !less(r2, n))
+                    subtract_n(r2);
+            }
+        }
+
+        /**
+         * @brief Returns the number of significant bits of the modulus.
+         */
+        int bit_length() const {
+            int bits = 64 * limbs;
+            for (uint64_t top = n[limbs - 1]; (top >> 63) == 0; top <<= 1)
+                bits--;
+            return bits;
+        }
+
+        /**
+         * @brief Computes out = a * b * R^(-1) mod n (CIOS method).
+         * 
+         * @param a The first factor, smaller than n.
+         * @param b The second factor, smaller than n.
+         * @param out The product, may alias a or b.
+         */
+        void mul(const uint64_t* a, const uint64_t* b, uint64_t* out) const {
+            uint64_t t[max_limbs + 2] = {};
+            for (int i = 0; i < limbs; i++) {
+                uint128_t c = 0;
+                for (int j = 0; j < limbs; j++) {
+                    c += uint128_t(a[j]) * b[i] + t[j];
+                    t[j] = uint64_t(c);
+                    c >>= 64;
+                }
+                c += t[limbs];
+                t[limbs] = uint64_t(c);
+                t[limbs + 1] = uint64_t(c >> 64);
+
+                uint64_t m = t[0] * n_inv;
+                c = (uint128_t(m) * n[0] + t[0]) >> 64;
+                for (int j = 1; j < limbs; j++) {
+                    c += uint128_t(m) * n[j] + t[j];
+                    t[j - 1] = uint64_t(c);
+                    c >>= 64;
+                }
+                c += t[limbs];
+                t[limbs - 1] = uint64_t(c);
+                t[limbs] = t[limbs + 1] + uint64_t(c >> 64);
+            }
+            if (t[limbs] != 0 || !less(t, n))
+                subtract_n(t);
+            for (int i = 0; i < limbs; i++)
+                out[i] = t[i];
+        }
+
+        /**
+         * @brief Converts a number smaller than n into Montgomery form.
+         */
+        void to_montgomery(const uint64_t* a, uint64_t* out) const {
+            mul(a, r2, out);
+        }
+
+        /**
+         * @brief Converts a number out of Montgomery form.
+         */
+        void from_montgomery(const uint64_t* a, uint64_t* out) const {
+            uint64_t one[max_limbs] = {1};
+            mul(a, one, out);
+        }
+
+        /**
+         * @brief Computes a * b * R^(-1) mod n for a single-limb modulus.
+         */
+        uint64_t mul64(uint64_t a, uint64_t b) const {
+            uint128_t t = uint128_t(a) * b;
+            // m * n has the same low half as t, so (t - m * n) / 2^64 is just the difference of the high halves
+            uint64_t m = uint64_t(t) * (0 - n_inv);
+            uint64_t th = uint64_t(t >> 64), mh = uint64_t((uint128_t(m) * n[0]) >> 64);
+            uint64_t u = th - mh;
+            return u + (th < mh ? n[0] : 0);
+        }
+
+        /**
+         * @brief Converts a number out of Montgomery form for a single-limb modulus.
+         */
+        uint64_t from_montgomery64(uint64_t a) const {
+            uint64_t m = a * (0 - n_inv);
+            uint64_t mh = uint64_t((uint128_t(m) * n[0]) >> 64);
+            return (0 - mh) + (mh != 0 ? n[0] : 0);
+        }
+
+    private:
+        bool less(const uint64_t* a, const uint64_t* b) const {
+            for (int i = limbs - 1; i >= 0; i--) {
+                if (a[i] != b[i])
+                    return a[i] < b[i];
+            }
+            return false;
+        }
+
+        void subtract_n(uint64_t* a) const {
+            uint64_t borrow = 0;
+            for (int i = 0; i < limbs; i++) {
+                uint64_t d = a[i] - n[i] - borrow;
+                borrow = (a[i] < n[i]) || (a[i] == n[i] && borrow);
+                a[i] = d;
+            }
+        }
+    };
 }
 
 #endif
\ No newline at end of file
@@ -12,6 +12,25 @@
 
 namespace DiceForge
 {    
+    /// @brief Returns log(k!) for a non-negative integer k, by Stirling's series with Hormann's correction term fc(k)
+    /// @note Unlike lgamma, it does not write the global signgam, so it can be called from several threads at once
+    inline real_t log_factorial(real_t k)
+    {
+        // fc(k) = log(k!) - log(sqrt(2 pi)) - (k + 0.5) log(k + 1) + (k + 1), tabulated for small k
+        static constexpr real_t fc_table[10] = {
+            0.08106146679532726, 0.04134069595540929, 0.02767792568499834, 0.02079067210376509, 0.01664469118982119,
+            0.01387612882307075, 0.01189670994589177, 0.01041126526197209, 0.009255462182712733, 0.008330563433362871
+        };
+        real_t fc;
+        if (k < 10)
+            fc = fc_table[int(k)];
+        else {
+            real_t x = k + 1, x2 = x * x;
+            fc = (1.0 / 12 - (1.0 / 360 - (1.0 / 1260 - 1.0 / (1680 * x2)) / x2) / x2) / x;
+        }
+        return 0.91893853320467274 + (k + 0.5) * log(k + 1) - (k + 1) + fc;
+    }
+
     /// @brief DiceForge::Continuous - A generic class for distributions describing continuous random variables
     class Continuous
     {
@@ -12,11 +12,19 @@ namespace DiceForge
         }
     }
 
-    real_t Cauchy::next(real_t r) 
+    real_t Cauchy::next(real_t r) const
     {
         return gamma * tan(M_PI * (r - 0.5)) + x0;
     }
 
+    Cauchy::Sampler Cauchy::prepare() const
+    {
+        Sampler sampler;
+        sampler.x0 = x0;
+        sampler.gamma = gamma;
+        return sampler;
+    }
+
     real_t Cauchy::variance() const 
     {
         return std::numeric_limits<real_t>().quiet_NaN();
@@ -2,6 +2,7 @@
 #define DF_CAUCHY_H
 
 #include "distribution.h"
+#include "generator.h"
 
 namespace DiceForge {
     /// @brief DiceForge::Cauchy - A Continuous Probability Distribution (Cauchy) 
@@ -16,7 +17,23 @@ namespace DiceForge {
             Cauchy(real_t x0 = 0, real_t gamma = 1);
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            real_t next(real_t r);
+            real_t next(real_t r) const;
+            /// @brief DiceForge::Cauchy::Sampler - Draws from the distribution, with the location and scale copied out of it
+            class Sampler {
+                private:
+                    friend class Cauchy;
+                    real_t x0, gamma;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    real_t operator()(G& rng) const
+                    {
+                        return gamma * tan(M_PI * (as_generator(rng).next_unit() - 0.5)) + x0;
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             /// @note The variation of a Cauchy distribution is undefined
             /// @returns NaN
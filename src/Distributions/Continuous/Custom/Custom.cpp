@@ -7,58 +7,65 @@ namespace DiceForge {
     CustomDistribution::CustomDistribution(real_t lower, real_t upper, PDF_Function pdf, int n) 
         : lower_limit(lower), upper_limit(upper), pdf_function(pdf)
     {
-        // Simpson's rule for CDF calculation
-        real_t h = (upper - lower) / real_t(n); // Step size, subject to change 
-        real_t sum = 0.0;
-        real_t x2 = 0.0;
-        real_t cdf = 0;
-
-        for (real_t x = lower_limit; x < upper_limit; x += h) {
-            x2=x+h; 
-            sum = simpson(pdf_function, x, x2);
-            cdf+=sum ;
-            cdf_values.push_back(std::make_pair(x, cdf));
-        }
+        if (!(upper > lower) || n < 1)
+            throw std::invalid_argument("Expected lower < upper and n > 0!");
+
+        // Single pass of Simpson's rule over each interval, the pdf is sampled at the ends and midpoints
+        step = (upper - lower) / real_t(n);
+        std::vector<real_t> f(2 * n + 1);
+        for (int i = 0; i <= 2 * n; i++)
+            f[i] = pdf_function(lower + i * step / 2);
 
-        sum = 0.0;
-        for (real_t x = lower_limit; x < upper_limit; x += h) {
-            sum += h * x * pdf_function(x);
+        cdf_values.resize(n + 1);
+        cdf_values[0] = 0;
+        real_t moment1 = 0, moment2 = 0;
+        for (int k = 0; k < n; k++) {
+            real_t x0 = lower + k * step, xm = x0 + step / 2, x1 = x0 + step;
+            real_t f0 = f[2 * k], fm = f[2 * k + 1], f1 = f[2 * k + 2];
+            // Negative densities are ignored so that the cdf stays monotone
+            real_t area = std::max(real_t(0), step * (f0 + 4 * fm + f1) / 6);
+            cdf_values[k + 1] = cdf_values[k] + area;
+            moment1 += step * (x0 * f0 + 4 * xm * fm + x1 * f1) / 6;
+            moment2 += step * (x0 * x0 * f0 + 4 * xm * xm * fm + x1 * x1 * f1) / 6;
         }
-        m_expectation = (sum/n);
 
-        sum = 0.0;        
-        for (real_t x = lower_limit; x < upper_limit; x += h) {
-            real_t diff = x - m_expectation;
-            sum += h * diff * diff * pdf_function(x); // Integrate (x - mean)^2 * f(x)
+        real_t total = cdf_values[n];
+        if (!(total > 0) || std::isinf(total))
+            throw std::invalid_argument("The pdf must have a positive and finite integral over the range!");
+        m_expectation = moment1 / total;
+        m_variance = moment2 / total - m_expectation * m_expectation;
+
+        // Guide table, one entry per interval
+        guide.resize(n);
+        int k = 0;
+        for (int j = 0; j < n; j++) {
+            real_t target = total * j / n;
+            while (k + 1 < n && cdf_values[k + 1] <= target)
+                k++;
+            guide[j] = k;
         }
-        m_variance = (sum/n);
     }
 
-    real_t CustomDistribution::next(real_t r)
+    real_t CustomDistribution::next(real_t r) const
     {
-        // Find the two CDF values between which the random number lies
-        real_t prev_cdf = 0.0, next_cdf = 0.0;
-        for (const auto& pair : cdf_values) {
-            if (pair.second > r) {
-                next_cdf = pair.second;
-                break;
-            }
-            prev_cdf = pair.second;
-        }
-    
-        // Linear interpolation to find the corresponding input value
-        real_t prev_input = 0.0, next_input = 0.0;
-        for (const auto& pair : cdf_values) {
-            if (pair.second == prev_cdf)
-                prev_input = pair.first;
-            else if (pair.second == next_cdf) {
-                next_input = pair.first;
-                break;
-            }
-        }
+        // Start from the guide entry and walk up to the interval where the cdf crosses r
+        const size_t n = guide.size();
+        real_t target = r * cdf_values[n];
+        size_t k = guide[std::min(size_t(r * n), n - 1)];
+        while (k + 1 < n && cdf_values[k + 1] <= target)
+            k++;
+
+        // Linear interpolation of the cdf within the interval
+        real_t area = cdf_values[k + 1] - cdf_values[k];
+        real_t fraction = area > 0 ? (target - cdf_values[k]) / area : 0;
+        return lower_limit + (k + fraction) * step;
+    }
 
-        // Interpolate
-        return prev_input + ((r - prev_cdf) / (next_cdf - prev_cdf)) * (next_input - prev_input);
+    CustomDistribution::Sampler CustomDistribution::prepare() const
+    {
+        Sampler sampler;
+        sampler.dist = this;
+        return sampler;
     }
         
     real_t CustomDistribution::expectation() const 
@@ -94,7 +101,10 @@ namespace DiceForge {
         if (x>upper_limit || x<lower_limit)
             throw std::invalid_argument("Enter a value within the domain of this pdf!");
             
-        return (simpson(pdf_function,lower_limit, x, 1000));    // number of iterations in Simpson is subject to change
+        // Tabulated integral up to the start of the interval, plus Simpson's rule over the rest
+        size_t k = std::min(size_t((x - lower_limit) / step), guide.size() - 1);
+        real_t x0 = lower_limit + k * step;
+        return cdf_values[k] + (x - x0) * (pdf_function(x0) + 4 * pdf_function((x0 + x) / 2) + pdf_function(x)) / 6;
     }
 
 } // namespace DiceForge
@@ -2,6 +2,7 @@
 #define DF_CUSTOM_DISTRIBUTION_H
 
 #include "distribution.h"
+#include "generator.h"
 #include "types.h"
 #include <vector>
 #include <functional>
@@ -17,7 +18,9 @@ namespace DiceForge {
         real_t lower_limit;
         real_t upper_limit;
         real_t m_expectation, m_variance;
-        std::vector<std::pair<real_t, real_t> > cdf_values; // (input, cdf)
+        real_t step; // Width of the intervals of the table
+        std::vector<real_t> cdf_values; // Integral of the pdf from lower_limit up to lower_limit + k * step
+        std::vector<size_t> guide; // guide[j] is the first interval where the cdf reaches j / guide.size() of the total (Chen & Asau)
         PDF_Function pdf_function; // Declare pdf_function as a member variable
 
     public:
@@ -25,11 +28,33 @@ namespace DiceForge {
         /// @param lower lower bound for the random variable (finite)
         /// @param upper upper bound for the random variable (finite)
         /// @param pdf probability density function describing the distribution
-        /// @param n number of points where the pdf should be sampled for expectation, variance and cdf calculations (higher n provides better accuracy) 
+        /// @param n number of intervals the range is split into for expectation, variance and cdf calculations (higher n provides better accuracy)
+        /// @note The pdf is evaluated 2n + 1 times while constructing the distribution, and twice per cdf evaluation
         CustomDistribution(real_t lower, real_t upper, PDF_Function pdf, int n = 1000);
 
-        real_t next(real_t r);
+        /// @brief Returns the next value of the random variable described by the distribution
+        /// @param r A random real number uniformly distributed between 0 and 1
+        /// @note Takes O(1) expected time, the cdf is interpolated linearly within the intervals of the table
+        real_t next(real_t r) const;
         
+        /// @brief DiceForge::CustomDistribution::Sampler - Draws from the distribution through its cdf table
+        class Sampler {
+            private:
+                friend class CustomDistribution;
+                const CustomDistribution* dist;
+            public:
+                /// @brief Returns the next value of the random variable described by the distribution
+                /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                template <typename G>
+                real_t operator()(G& rng) const
+                {
+                    return dist->next(as_generator(rng).next_unit());
+                }
+        };
+        /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+        /// @note The sampler refers to the tables of the distribution, which must outlive it
+        Sampler prepare() const;
+
         /// @brief Returns the expected value of the distribution
         /// @note The expectation value is approximate
         real_t expectation() const override final;
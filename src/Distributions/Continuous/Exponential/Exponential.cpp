@@ -9,9 +9,16 @@ namespace DiceForge {
         }
     }
 
-    real_t Exponential::next(real_t r) {
+    real_t Exponential::next(real_t r) const {
         // Inverse transform sampling for exponential distribution
-        return -(log(1 - r) / k);
+        return x0 - log(1 - r) / k;
+    }
+
+    Exponential::Sampler Exponential::prepare() const {
+        Sampler sampler;
+        sampler.x0 = x0;
+        sampler.scale = -1 / k;
+        return sampler;
     }
 
     real_t Exponential::variance() const {
@@ -2,6 +2,7 @@
 #define DF_EXPONENTIAL_H
 
 #include "distribution.h"
+#include "generator.h"
 
 namespace DiceForge {
     /// @brief DiceForge::Exponential - A continuous exponential probability distribution
@@ -21,7 +22,31 @@ namespace DiceForge {
          * @param r Random number in the range [0,1).
          * @returns Random number from the exponential distribution.
          */
-        real_t next(real_t r);
+        real_t next(real_t r) const;
+        /**
+         * @brief DiceForge::Exponential::Sampler - Draws from the distribution, with the negated inverse rate precomputed
+         */
+        class Sampler {
+            private:
+                friend class Exponential;
+                real_t x0, scale; // scale = -1 / k
+            public:
+                /**
+                 * @brief Generate a random number from the exponential distribution.
+                 * @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937).
+                 * @returns Random number from the exponential distribution.
+                 */
+                template <typename G>
+                real_t operator()(G& rng) const
+                {
+                    return x0 + log(as_generator(rng).next_unit_open()) * scale;
+                }
+        };
+        /**
+         * @brief Prepare a sampler of the distribution, for drawing many values with the same parameters.
+         * @returns Sampler of the exponential distribution.
+         */
+        Sampler prepare() const;
         /**
          * @brief Calculate the variance of the distribution.
          * @returns Variance of the exponential distribution.
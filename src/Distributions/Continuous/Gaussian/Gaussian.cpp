@@ -4,7 +4,7 @@
 namespace DiceForge
 {
     Gaussian::Gaussian(real_t mu, real_t sigma)
-        : mu(mu), sigma(sigma)
+        : mu(mu), sigma(sigma), zig(&ziggurat())
     {
         if (sigma < std::numeric_limits<real_t>().epsilon())
         {
@@ -12,11 +12,45 @@ namespace DiceForge
         }
     }
 
-    real_t Gaussian::next(real_t r1, real_t r2)
+    Gaussian::Ziggurat::Ziggurat()
+    {
+        // Marsaglia & Tsang's tail start, the common area of the layers follows from it
+        const real_t r = 3.6541528853610088;
+        const real_t fr = exp(-0.5 * r * r);
+        const real_t v = r * fr + sqrt(M_PI / 2) * erfc(r / sqrt(2.0));
+
+        x[0] = v / fr;
+        x[1] = r;
+        for (int i = 1; i < 255; i++)
+        {
+            x[i + 1] = sqrt(-2 * log(v / x[i] + exp(-0.5 * x[i] * x[i])));
+        }
+        x[256] = 0;
+
+        for (int i = 0; i < 257; i++)
+        {
+            f[i] = exp(-0.5 * x[i] * x[i]);
+        }
+    }
+
+    const Gaussian::Ziggurat& Gaussian::ziggurat()
+    {
+        static const Ziggurat tables;
+        return tables;
+    }
+
+    real_t Gaussian::next(real_t r1, real_t r2) const
     {
         return (sqrt(-2.0 * log(r1)) * cos(2 * M_PI * r2)) * sigma + mu;
     }
 
+    Gaussian::Sampler Gaussian::prepare() const
+    {
+        Sampler sampler;
+        sampler.dist = this;
+        return sampler;
+    }
+
     real_t Gaussian::variance() const
     {
         return sigma * sigma;
@@ -2,6 +2,7 @@
 #define DF_GAUSSIAN_H
 
 #include "distribution.h"
+#include "generator.h"
 
 namespace DiceForge {
     /// @brief DiceForge::Gaussian - A Continuous Probability Distribution (Gaussian) 
@@ -9,6 +10,63 @@ namespace DiceForge {
         private:
             real_t mu, sigma;
             real_t myerf(real_t x) const;
+
+            // Ziggurat of 256 layers of equal area (Marsaglia & Tsang), layer i spans [0, x[i]) below
+            // the density at x[i + 1] and the bottom layer also holds the tail beyond x[1]
+            struct Ziggurat {
+                real_t x[257];  // Right edges of the layers, decreasing down to x[256] = 0
+                real_t f[257];  // Unnormalized density exp(-x^2 / 2) at the edges
+                Ziggurat();
+            };
+            static const Ziggurat& ziggurat();
+            const Ziggurat* zig;
+
+            // 64 random bits from the generator, concatenating draws of narrower generators
+            template <typename G>
+            static uint64_t random_bits(G& rng)
+            {
+                if constexpr (sizeof(rng.next()) >= sizeof(uint64_t))
+                    return uint64_t(rng.next());
+                else {
+                    uint64_t hi = uint64_t(rng.next());
+                    return (hi << 32) | uint64_t(rng.next());
+                }
+            }
+
+            // Standard normal variate, starting from the given 64 random bits (layer in the lowest 8 bits,
+            // signed abscissa in the highest 53 bits)
+            template <typename G>
+            real_t standard(G& rng, uint64_t bits) const
+            {
+                const real_t* x = zig->x;
+                const real_t* f = zig->f;
+                for (;;)
+                {
+                    int i = bits & 0xFF;
+                    real_t z = real_t(int64_t(bits) >> 11) * 0x1.0p-52 * x[i];
+
+                    // Inside the rectangle fully under the curve (about 99% of the draws)
+                    if (fabs(z) < x[i + 1])
+                        return z;
+
+                    if (i == 0)
+                    {
+                        // Tail beyond x[1] (Marsaglia's method)
+                        real_t a, b;
+                        do {
+                            a = -log(rng.next_unit_open()) / x[1];
+                            b = -log(rng.next_unit_open());
+                        } while (b + b < a * a);
+                        return z < 0 ? -(x[1] + a) : x[1] + a;
+                    }
+
+                    // Wedge between the rectangle and the curve
+                    if (f[i] + rng.next_unit() * (f[i + 1] - f[i]) < exp(-0.5 * z * z))
+                        return z;
+
+                    bits = random_bits(rng);
+                }
+            }
         public:
             /// @brief Initializes the Gaussian distribution about location x = mu with standard deviation sigma
             /// @param mu mean of the distribution
@@ -17,7 +75,70 @@ namespace DiceForge {
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r1 A random real number uniformly distributed between 0 and 1
             /// @param r2 A random real number uniformly distributed between 0 and 1
-            real_t next(real_t r1, real_t r2);
+            real_t next(real_t r1, real_t r2) const;
+            /// @brief Returns the next value of the random variable described by the distribution (Ziggurat method)
+            /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+            template <typename G>
+            real_t next(G& rng) const
+            {
+                auto&& g = as_generator(rng);
+                return standard(g, random_bits(g)) * sigma + mu;
+            }
+            /// @brief Fills the given array with values of the random variable described by the distribution
+            /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+            /// @param out array to fill
+            /// @param n number of values to generate
+            /// @note The random bits are drawn in bulk through Generator::fill, so this is faster than calling next(rng) n times
+            template <typename G>
+            void sample(G& rng, real_t* out, size_t n) const
+            {
+                auto&& g = as_generator(rng);
+                typedef decltype(g.next()) T;
+                constexpr size_t block = 256;
+                constexpr size_t words = sizeof(T) >= sizeof(uint64_t) ? 1 : 2;
+                T raw[block * words];
+                const real_t* x = zig->x;
+
+                while (n > 0)
+                {
+                    size_t len = std::min(n, block);
+                    g.fill(raw, len * words);
+                    for (size_t k = 0; k < len; k++)
+                    {
+                        uint64_t bits;
+                        if constexpr (words == 1)
+                            bits = uint64_t(raw[k]);
+                        else
+                            bits = (uint64_t(raw[2 * k]) << 32) | uint64_t(raw[2 * k + 1]);
+
+                        // Fast path of standard(), the rejected draws are finished there
+                        int i = bits & 0xFF;
+                        real_t z = real_t(int64_t(bits) >> 11) * 0x1.0p-52 * x[i];
+                        if (fabs(z) >= x[i + 1])
+                            z = standard(g, bits);
+                        out[k] = z * sigma + mu;
+                    }
+                    out += len;
+                    n -= len;
+                }
+            }
+            /// @brief DiceForge::Gaussian::Sampler - Draws from the distribution by the Ziggurat method
+            class Sampler {
+                private:
+                    friend class Gaussian;
+                    const Gaussian* dist;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    real_t operator()(G& rng) const
+                    {
+                        return dist->next(rng);
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            /// @note The sampler refers to the distribution, which must outlive it
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             real_t variance() const override final;
             /// @brief Returns the theoretical expectation value of the distribution
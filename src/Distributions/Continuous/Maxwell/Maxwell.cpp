@@ -12,13 +12,19 @@ namespace DiceForge
         }
     }
 
-    real_t Maxwell::next(real_t r1, real_t r2, real_t r3) 
+    real_t Maxwell::next(real_t r1, real_t r2, real_t r3) const
     {
-        real_t x1 = (sqrt(-2.0 * log(r1)) * cos(2 * M_PI * r2)) * a;
-        real_t x2 = (sqrt(-2.0 * log(r1)) * sin(2 * M_PI * r2)) * a;
+        // x1^2 + x2^2 of a Box-Muller pair is -2 a^2 log(r1), x3 is an independent normal variate
         real_t x3 = (sqrt(-2.0 * log(r2)) * cos(2 * M_PI * r3)) * a;
-    
-        return sqrt(x1*x1 + x2*x2 + x3*x3);
+
+        return sqrt(-2.0 * a * a * log(r1) + x3*x3);
+    }
+
+    Maxwell::Sampler Maxwell::prepare() const
+    {
+        Sampler sampler;
+        sampler.scale = -2 * a * a;
+        return sampler;
     }
 
     real_t Maxwell::variance() const 
@@ -2,6 +2,7 @@
 #define DF_MAXWELL_H
 
 #include "distribution.h"
+#include "generator.h"
 
 namespace DiceForge {
     /// @brief DiceForge::Maxwell - A Continuous Probability Distribution (Maxwell) 
@@ -18,7 +19,28 @@ namespace DiceForge {
             /// @param r1 A random real number uniformly distributed between 0 and 1
             /// @param r2 A random real number uniformly distributed between 0 and 1
             /// @param r3 A random real number uniformly distributed between 0 and 1
-            real_t next(real_t r1, real_t r2, real_t r3);
+            real_t next(real_t r1, real_t r2, real_t r3) const;
+            /// @brief DiceForge::Maxwell::Sampler - Draws from the distribution without rejection, as a times the square root
+            /// of a chi-squared variate with 3 degrees of freedom (an exponential variate plus the square of a normal one)
+            class Sampler {
+                private:
+                    friend class Maxwell;
+                    real_t scale; // -2 a^2
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    real_t operator()(G& rng) const
+                    {
+                        auto&& g = as_generator(rng);
+                        real_t c = cos(2 * M_PI * g.next_unit());
+                        real_t l1 = log(g.next_unit_open());
+                        real_t l2 = log(g.next_unit_open());
+                        return sqrt(scale * (l1 + l2 * c * c));
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             real_t variance() const override final;
             /// @brief Returns the theoretical expectation value of the distribution
@@ -13,10 +13,17 @@ namespace DiceForge{
         }
     }
 
-    real_t Weibull::next(real_t r) {
+    real_t Weibull::next(real_t r) const {
         return lambda * std::pow(-std::log(1 - r), 1/k);
     }
 
+    Weibull::Sampler Weibull::prepare() const {
+        Sampler sampler;
+        sampler.lambda = lambda;
+        sampler.inv_k = 1 / k;
+        return sampler;
+    }
+
     real_t Weibull::variance() const{
         return pow(lambda, 2) * (std::tgamma(1 + 2/k) - pow(std::tgamma(1 + 1/k), 2));
     }
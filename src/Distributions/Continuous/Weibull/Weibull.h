@@ -2,6 +2,7 @@
 #define DF_WEIBULL_H
 
 #include "distribution.h"
+#include "generator.h"
 
 namespace DiceForge {
 
@@ -18,8 +19,25 @@ namespace DiceForge {
         
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            real_t next(real_t r);
+            real_t next(real_t r) const;
         
+            /// @brief DiceForge::Weibull::Sampler - Draws from the distribution, with the inverse of the shape factor precomputed
+            class Sampler {
+                private:
+                    friend class Weibull;
+                    real_t lambda, inv_k;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    real_t operator()(G& rng) const
+                    {
+                        return lambda * pow(-log(as_generator(rng).next_unit_open()), inv_k);
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            Sampler prepare() const;
+
             /// @brief Returns the theoretical variance of the distribution
             /// @note The variation of a Weibull distribution is undefined
             /// @returns NaN
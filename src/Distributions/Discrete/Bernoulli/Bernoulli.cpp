@@ -12,7 +12,7 @@ namespace DiceForge{
         }
     }
     
-    int_t Bernoulli::next(real_t r) 
+    int_t Bernoulli::next(real_t r) const
     {  // Generate a random integer based on the Bernoulli distribution
         if (r>p) { 
             return 0;
@@ -21,6 +21,13 @@ namespace DiceForge{
             return 1;
         }
     }
+
+    Bernoulli::Sampler Bernoulli::prepare() const
+    {
+        Sampler sampler;
+        sampler.p = p;
+        return sampler;
+    }
     
     real_t Bernoulli::variance() const{
         // Variance of Bernoulli distribution: p * (1 - p)
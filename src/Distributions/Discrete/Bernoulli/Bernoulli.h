@@ -2,6 +2,7 @@
 #define DF_BERNOULLI_H
 
 #include "distribution.h"
+#include "generator.h"
 
 namespace DiceForge {
     /// @brief DiceForge::Bernoulli - A Discrete Probability Distribution (Bernoulli) 
@@ -14,7 +15,23 @@ namespace DiceForge {
             Bernoulli(real_t p);
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            int_t next(real_t r);
+            int_t next(real_t r) const;
+            /// @brief DiceForge::Bernoulli::Sampler - Draws from the distribution without branching
+            class Sampler {
+                private:
+                    friend class Bernoulli;
+                    real_t p;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    int_t operator()(G& rng) const
+                    {
+                        return int_t(as_generator(rng).next_unit() <= p);
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             /// @returns p(1-p)
             real_t variance() const override final;
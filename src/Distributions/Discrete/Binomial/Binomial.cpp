@@ -8,22 +8,52 @@ Binomial::Binomial(uint_t n, real_t p)
         throw std::invalid_argument("Expected n > 0 and 0 <= p <= 1");
     }
 
-    pmfs = std::vector<real_t>(n+1);
+    mode = std::min(n, uint_t(floor((n + 1) * p)));
+    pmf_mode = pmf(mode);
+    cdf_mode = cdf(mode);
 
-    for (int i = 0; i <= n; i++) {
-        pmfs[i] = nCr(n, i) * std::pow(p, i) * std::pow((1-p), i);
-    }
+    // Transformed rejection constants (Hormann, 1993), only used when n * s >= 10
+    s = std::min(p, 1 - p);
+    spq = sqrt(n * s * (1 - s));
+    b = 1.15 + 2.53 * spq;
+    a = -0.0873 + 0.0248 * b + 0.01 * s;
+    c = n * s + 0.5;
+    alpha = (2.83 + 5.1 / b) * spq;
+    vr = 0.92 - 4.2 / b;
+    urvr = 0.86 * vr;
+    m = uint_t(floor((n + 1) * s));
+    lpq = log(s / (1 - s));
+    h = log_factorial(m) + log_factorial(n - m);
 }
 
-int_t Binomial::next(real_t r) {
-    real_t s = 0;
-    for (int i = 0; i <= n; i++) {
-        if (s < r <= s + pmfs[i]) 
-            return i;
-        s += pmfs[i];
+int_t Binomial::next(real_t r) const {
+    if (p == 0 || p == 1 || n == 0)
+        return p == 1 ? n : 0;
+
+    // Smallest k with cdf(k) >= r, walking from the mode with the ratio of consecutive pmfs
+    uint_t k = mode;
+    real_t pk = pmf_mode, cdf_k = cdf_mode;
+    if (r <= cdf_k) {
+        while (k > 0 && cdf_k - pk >= r) {
+            cdf_k -= pk;
+            pk *= k * (1 - p) / ((n - k + 1) * p);
+            k--;
+        }
     }
+    else {
+        while (cdf_k < r && k < n) {
+            pk *= (n - k) * p / ((k + 1) * (1 - p));
+            k++;
+            cdf_k += pk;
+        }
+    }
+    return k;
+}
 
-    return n;
+Binomial::Sampler Binomial::prepare() const {
+    Sampler sampler;
+    sampler.dist = this;
+    return sampler;
 }
 
 real_t Binomial::variance() const {
@@ -43,20 +73,45 @@ int_t Binomial::maxValue() const {
 }
 
 real_t Binomial::pmf(int_t k) const {
-    if (k > n || k < 0)
+    if (k > int_t(n) || k < 0)
     {
         return 0;
     }
-    return pmfs[k];
+    if (p == 0 || p == 1)
+    {
+        return k == (p == 1 ? int_t(n) : 0);
+    }
+    return exp(log_factorial(n) - log_factorial(k) - log_factorial(n - k) + k * log(p) + (n - k) * log1p(-p));
 }
 
 real_t Binomial::cdf(int_t k) const {
-    real_t cdf = 0;
-    for (uint_t i = 0; i <= k; i++)
+    if (k < 0)
+    {
+        return 0;
+    }
+    if (k >= int_t(n))
+    {
+        return 1;
+    }
+
+    // Sum the shorter tail, starting next to k and stopping once the terms no longer matter
+    real_t sum = 0;
+    if (k < int_t(mode))
+    {
+        real_t pk = pmf(k);
+        for (int_t i = k; i >= 0 && pk > sum * 1e-17; i--)
+        {
+            sum += pk;
+            pk *= i * (1 - p) / ((n - i + 1) * p);
+        }
+        return sum;
+    }
+    real_t pk = pmf(k + 1);
+    for (int_t i = k + 1; i <= int_t(n) && pk > sum * 1e-17; i++)
     {
-        cdf += pmf(i);
+        sum += pk;
+        pk *= (n - i) * p / ((i + 1) * (1 - p));
     }
-    
-    return cdf;
+    return 1 - sum;
 }
 } // namespace DiceForge
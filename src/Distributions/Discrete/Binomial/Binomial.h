@@ -2,7 +2,7 @@
 #define DF_BINOMIAL_H
 
 #include "distribution.h"
-#include <vector>
+#include "generator.h"
 
 namespace DiceForge {
     /// @brief DiceForge::Binomial - A Discrete Probability Distribution (Binomial Distribution) 
@@ -10,7 +10,12 @@ namespace DiceForge {
         private:
             uint_t n;
             real_t p;
-            std::vector<real_t> pmfs;
+            uint_t mode;            // floor((n + 1) p), where the inversion search starts
+            real_t pmf_mode;        // pmf at the mode
+            real_t cdf_mode;        // cdf at the mode
+            // Constants of the transformed rejection (BTRS) for s = min(p, 1 - p)
+            real_t s, spq, b, a, c, alpha, vr, urvr, lpq, h;
+            uint_t m;
         public:
             /// @brief Initializes the Binomial Distribution with (n, p)
             /// @param n number of trials 
@@ -19,7 +24,66 @@ namespace DiceForge {
             Binomial(uint_t n, real_t p);
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            int_t next(real_t r);
+            /// @note Inverts the cdf by searching outwards from the mode, which takes O(sqrt(n p (1 - p))) expected time
+            int_t next(real_t r) const;
+            /// @brief Returns the next value of the random variable described by the distribution
+            /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+            /// @note Takes O(1) expected time, using transformed rejection (Hormann's BTRS) when n min(p, 1 - p) >= 10
+            /// and inversion otherwise
+            template <typename G, std::enable_if_t<is_bit_generator<G>::value, int> = 0>
+            int_t next(G& rng) const
+            {
+                auto&& g = as_generator(rng);
+                if (n * s < 10)
+                    return next(g.next_unit());
+
+                for (;;)
+                {
+                    real_t u, v = g.next_unit();
+                    if (v <= urvr)
+                    {
+                        // Squeeze, accepted without evaluating the pmf
+                        u = v / vr - 0.43;
+                        return result(uint_t(floor((2 * a / (0.5 - fabs(u)) + b) * u + c)));
+                    }
+                    if (v >= vr)
+                    {
+                        u = g.next_unit() - 0.5;
+                    }
+                    else
+                    {
+                        u = v / vr - 0.93;
+                        u = (u < 0 ? -0.5 : 0.5) - u;
+                        v = g.next_unit() * vr;
+                    }
+
+                    real_t us = 0.5 - fabs(u);
+                    real_t k = floor((2 * a / us + b) * u + c);
+                    if (k < 0 || k > n)
+                        continue;
+
+                    v = v * alpha / (a / (us * us) + b);
+                    if (log(v) <= h - log_factorial(k) - log_factorial(n - k) + (k - m) * lpq)
+                        return result(uint_t(k));
+                }
+            }
+            /// @brief DiceForge::Binomial::Sampler - Draws from the distribution through its precomputed inversion and rejection constants
+            class Sampler {
+                private:
+                    friend class Binomial;
+                    const Binomial* dist;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    int_t operator()(G& rng) const
+                    {
+                        return dist->next(rng);
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            /// @note The sampler refers to the distribution, which must outlive it
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             real_t variance() const override final;
             /// @brief Returns the theoretical expectation value of the distribution
@@ -33,6 +97,12 @@ namespace DiceForge {
             real_t pmf(int_t k) const override final;
             /// @brief Cumulative distribution function of the Binomial distribution
             real_t cdf(int_t k) const override final;
+        private:
+            // Maps a sample drawn for s back to p
+            int_t result(uint_t k) const
+            {
+                return p <= 0.5 ? k : n - k;
+            }
     };
 }
 
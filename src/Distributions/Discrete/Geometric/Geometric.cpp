@@ -12,11 +12,18 @@ namespace DiceForge
         }
     }
 
-    int_t Geometric::next(real_t r) 
+    int_t Geometric::next(real_t r) const
     {  
         // Cutpoint method of sampling a Geometric distribution
         return floor(log(r)/log(1-p)) + 1;
     }
+
+    Geometric::Sampler Geometric::prepare() const
+    {
+        Sampler sampler;
+        sampler.inv_log_q = 1 / log(1 - real_t(p));
+        return sampler;
+    }
     
     real_t Geometric::variance() const{
         // Variance of Geometric distribution: (1-p)/(p*p)
@@ -2,6 +2,7 @@
 #define DF_GEOMETRIC_H
 
 #include "distribution.h"
+#include "generator.h"
 
 namespace DiceForge {
     /// @brief DiceForge::Geometric - A Discrete Probability Distribution (Geometric) 
@@ -14,7 +15,23 @@ namespace DiceForge {
             Geometric(real_t p);
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            int_t next(real_t r);            
+            int_t next(real_t r) const;            
+            /// @brief DiceForge::Geometric::Sampler - Draws from the distribution without branching, with 1 / log(1 - p) precomputed
+            class Sampler {
+                private:
+                    friend class Geometric;
+                    real_t inv_log_q;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    int_t operator()(G& rng) const
+                    {
+                        return int_t(floor(log(as_generator(rng).next_unit_open()) * inv_log_q)) + 1;
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             /// @returns (1-p)/(p^2)
             real_t variance() const override;
@@ -9,9 +9,15 @@ namespace DiceForge
         free(x_array);
     }
 
-    int_t Gibbs::next(real_t r){
+    int_t Gibbs::next(real_t r) const {
         // Binary search for x such that : P(X < x) <= r < P(X <= x)
-        return x_array[(std::upper_bound(cdf_array, cdf_array + n, r) - cdf_array)];
+        return x_array[std::min(int_t(std::upper_bound(cdf_array, cdf_array + n, r) - cdf_array), n - 1)];
+    }
+
+    Gibbs::Sampler Gibbs::prepare() const {
+        Sampler sampler;
+        sampler.dist = this;
+        return sampler;
     }
 
     real_t Gibbs::variance() const{
@@ -2,6 +2,7 @@
 #define DF_GIBBS_H
 
 #include "distribution.h"
+#include "generator.h"
 #include <algorithm>
 
 namespace DiceForge {
@@ -17,6 +18,8 @@ namespace DiceForge {
         int_t *x_array = nullptr;
         // Length of all 3 arrays
         int_t n = 0;
+        // Alias table of pmf_array, for drawing samples
+        AliasTable table;
     public:
         /// @brief Constructor to initialise private attributes of the distribution
         template <typename RandomAccessIterator1, typename RandomAccessIterator2>
@@ -69,14 +72,36 @@ namespace DiceForge {
                 pmf_array[i] /= cdf_array[n - 1];
                 cdf_array[i] /= cdf_array[n - 1];
             }
+
+            table = AliasTable(pmf_array, pmf_array + n);
         }
         // Destructor to free memory used by the 3 array attributes
         ~Gibbs();
         
         /// @brief Returns a sample of the random variable following the distribution given a 'r'
         /// @param r a uniformly distributed unit random variable
-        int_t next(real_t r);
+        /// @note Inverse cdf by binary search, so r maps monotonically to the sample (for antithetic or quasi-random r).
+        /// The Sampler draws from an alias table in O(1) time instead
+        int_t next(real_t r) const;
         
+        /// @brief DiceForge::Gibbs::Sampler - Draws from the distribution through its alias table
+        class Sampler {
+            private:
+                friend class Gibbs;
+                const Gibbs* dist;
+            public:
+                /// @brief Returns the next value of the random variable described by the distribution
+                /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                template <typename G>
+                int_t operator()(G& rng) const
+                {
+                    return dist->x_array[dist->table.index(as_generator(rng).next_unit())];
+                }
+        };
+        /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+        /// @note The sampler refers to the tables of the distribution, which must outlive it
+        Sampler prepare() const;
+
         /// @brief Returns the theoretical variance of the distribution
         real_t variance() const override;
         
@@ -44,17 +44,18 @@ namespace DiceForge
         }
     }
     // next function returns the index where cumulative[index] is just greater than r
-    int_t Hypergeometric::next(real_t r)
+    int_t Hypergeometric::next(real_t r) const
     {
-        for (int i = 0; i < std::min(n, K); i++)
-        {
-            /* code */
-            if (cumulative[i] >= r)
-            {
-                return i;
-            }
-        }
-        return (std::min(n, K));
+        // Binary search, the entries before max(0, n + K - N) are zero
+        int32_t m = std::min(n, K);
+        return std::lower_bound(cumulative.begin(), cumulative.begin() + m, r) - cumulative.begin();
+    }
+
+    Hypergeometric::Sampler Hypergeometric::prepare() const
+    {
+        Sampler sampler;
+        sampler.dist = this;
+        return sampler;
     }
 
     // theoritical expectation
@@ -2,6 +2,7 @@
 #define DF_HYPERGEOMETRIC_H
 
 #include "distribution.h"
+#include "generator.h"
 #include <vector>
 
 namespace DiceForge
@@ -11,8 +12,8 @@ namespace DiceForge
     /// replacement from an urn with two colors. n is the number of balls you take,
     /// K is the number of red balls in the urn, N is the total number of balls in
     /// the urn, and the return value is the number of red balls you get.
-    /// To regenerate samples of the variation this class uses inversion by chop-down
-    /// search from start when parameters are small
+    /// To regenerate samples of the variation this class uses inversion by binary
+    /// search of a table of the cdf
     class Hypergeometric : public Discrete
     {
     private:
@@ -32,7 +33,24 @@ namespace DiceForge
         Hypergeometric(int32_t N, int32_t K, int32_t n); 
         /// @brief Returns the next value of the random variable described by the distribution
         /// @param r A random real number uniformly distributed between 0 and 1
-        int_t next(real_t r);        
+        int_t next(real_t r) const;        
+        /// @brief DiceForge::Hypergeometric::Sampler - Draws from the distribution by binary search of its cdf table
+        class Sampler {
+            private:
+                friend class Hypergeometric;
+                const Hypergeometric* dist;
+            public:
+                /// @brief Returns the next value of the random variable described by the distribution
+                /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                template <typename G>
+                int_t operator()(G& rng) const
+                {
+                    return dist->next(as_generator(rng).next_unit());
+                }
+        };
+        /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+        /// @note The sampler refers to the tables of the distribution, which must outlive it
+        Sampler prepare() const;
         /// @brief Returns the theoretical variance of the distribution
         real_t variance() const override;
         /// @brief Returns the theoretical expectation value of the distribution
@@ -1,5 +1,6 @@
 #include "NegHypergeometric.h"
 #include "basicfxn.h"
+#include <algorithm>
 
 namespace DiceForge {
     
@@ -15,9 +16,13 @@ namespace DiceForge {
 
         // precalculate pmfs for faster random number generation
         pmfs = new real_t[K+1];
+        cumulative.resize(K + 1);
+        real_t s = 0;
         for (int k = 0; k <= K; k++)
         {
             pmfs[k] = nCr(k + r - 1, k) * nCr(N - r - k, K - k) / real_t(nCr(N, K));    
+            s += pmfs[k];
+            cumulative[k] = s;
         }
     }
 
@@ -26,19 +31,17 @@ namespace DiceForge {
         delete[] pmfs;
     }
 
-    int_t NegHypergeometric::next(real_t r) 
+    int_t NegHypergeometric::next(real_t r) const
     {
-        real_t s = 0;
-        for (int i = 0; i <= K; i++)
-        {
-            if (s < r <= s + pmfs[i])
-            {
-                return i;
-            }
-            s += pmfs[i];
-        }
+        // Smallest k with cdf(k) >= r, by binary search of the table
+        return std::lower_bound(cumulative.begin(), cumulative.end() - 1, r) - cumulative.begin();
+    }
 
-        return K;
+    NegHypergeometric::Sampler NegHypergeometric::prepare() const
+    {
+        Sampler sampler;
+        sampler.dist = this;
+        return sampler;
     }
 
     real_t NegHypergeometric::variance() const
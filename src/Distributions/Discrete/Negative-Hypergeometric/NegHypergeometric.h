@@ -2,6 +2,7 @@
 #define DF_NEGHYPERGEOMETIRC_H
 
 #include "distribution.h"
+#include "generator.h"
 
 namespace DiceForge {
     /// @brief DiceForge::NegHypergeometric - A Discrete Probability Distribution (Negative Hypergeometric) 
@@ -9,6 +10,7 @@ namespace DiceForge {
         private:
             uint_t N, K, r;
             real_t* pmfs;
+            std::vector<real_t> cumulative; // cdf at 0..K
         public:
             /// @brief Initializes the Negative Hypergeometric Distribution with (N, K, r)
             /// @param N size of the population 
@@ -20,7 +22,24 @@ namespace DiceForge {
             ~NegHypergeometric();
             /// @brief Returns the next value of the random variable described by the distribution
             /// @param r A random real number uniformly distributed between 0 and 1
-            int_t next(real_t r);
+            int_t next(real_t r) const;
+            /// @brief DiceForge::NegHypergeometric::Sampler - Draws from the distribution by binary search of its cdf table
+            class Sampler {
+                private:
+                    friend class NegHypergeometric;
+                    const NegHypergeometric* dist;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    int_t operator()(G& rng) const
+                    {
+                        return dist->next(as_generator(rng).next_unit());
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            /// @note The sampler refers to the tables of the distribution, which must outlive it
+            Sampler prepare() const;
             /// @brief Returns the theoretical variance of the distribution
             real_t variance() const override final;
             /// @brief Returns the theoretical expectation value of the distribution
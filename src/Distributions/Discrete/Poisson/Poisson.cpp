@@ -4,14 +4,43 @@
 
 DiceForge::Poisson::Poisson(DiceForge::real_t lambda)
 {
-    if (l < 0) {
+    if (lambda < 0) {
         throw std::invalid_argument("Lambda must not be negative!");
     }
     
     l=lambda;
-    sq=sqrt(2);
-    lnl=log(l);
-    g=l*lnl-lgamma(l+1);
+
+    if (l < inversion_limit) {
+        // cdf table, the mass beyond the last entry is below 1e-20 and is put in the last entry
+        real_t pk = exp(-l), sum = 0;
+        for (int k = 0; k < table_size; k++) {
+            sum += pk;
+            cdf_table[k] = std::min(sum, real_t(1));
+            pk *= l / (k + 1);
+        }
+        cdf_table[table_size - 1] = 1;
+
+        int k = 0;
+        for (int j = 0; j < guide_size; j++) {
+            while (cdf_table[k] <= real_t(j) / guide_size)
+                k++;
+            guide[j] = k;
+        }
+    }
+    else {
+        slam = sqrt(l);
+        loglam = log(l);
+        b = 0.931 + 2.53 * slam;
+        a = -0.059 + 0.02483 * b;
+        invalpha = 1.1239 + 1.1328 / (b - 3.4);
+        vr = 0.9277 - 3.6224 / (b - 2);
+    }
+}
+
+DiceForge::Poisson::Sampler DiceForge::Poisson::prepare() const{
+    Sampler sampler;
+    sampler.dist = this;
+    return sampler;
 }
 
 DiceForge::real_t DiceForge::Poisson::variance() const{
@@ -27,21 +56,36 @@ DiceForge::int_t DiceForge::Poisson::minValue() const{
 }
 
 DiceForge::int_t DiceForge::Poisson::maxValue() const{
-    return std::numeric_limits<int_t>().infinity();
+    return std::numeric_limits<int_t>().max();
 }
 
 
 DiceForge::real_t DiceForge::Poisson::pmf(DiceForge::int_t x) const{
-    return (pow(l,x)*exp(-l)/tgamma(x+1));
+    if (x < 0)
+        return 0;
+    if (l == 0)
+        return x == 0;
+    return exp(x * log(l) - l - log_factorial(x));
 }
 
 DiceForge::real_t DiceForge::Poisson::cdf(DiceForge::int_t x) const{
-   DiceForge::real_t sum=0,a=exp(-l);
-   for (int i=1; i<=x; i++){
-    a = a*(l/i);
-    sum+=a;
-   }
-   return (sum);
-}
-
+    if (x < 0)
+        return 0;
 
+    // Sum the shorter tail, starting next to x and stopping once the terms no longer matter
+    DiceForge::real_t sum = 0;
+    if (x < l) {
+        DiceForge::real_t a = pmf(x);
+        for (DiceForge::int_t i = x; i >= 0 && a > sum * 1e-17; i--) {
+            sum += a;
+            a *= i / l;
+        }
+        return sum;
+    }
+    DiceForge::real_t a = pmf(x + 1);
+    for (DiceForge::int_t i = x + 1; a > sum * 1e-17; i++) {
+        sum += a;
+        a *= l / (i + 1);
+    }
+    return 1 - sum;
+}
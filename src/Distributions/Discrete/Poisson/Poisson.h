@@ -9,30 +9,113 @@ namespace DiceForge {
     /// @brief DiceForge::Poisson - A discrete probability distribution
     class Poisson : public Discrete {
         private:
-            real_t l,sq,lnl,g;
+            real_t l;
+            // Below this lambda samples are drawn by inverting a table of the cdf, above it by PTRS
+            static constexpr real_t inversion_limit = 10;
+            // Table of the cdf for small lambda, with a guide table pointing into it
+            static constexpr int table_size = 64;
+            static constexpr int guide_size = 32;
+            real_t cdf_table[table_size];
+            int guide[guide_size];
+            // Constants of the transformed rejection (PTRS) for large lambda
+            real_t slam, loglam, b, a, invalpha, vr;
+
+            // Smallest k with cdf(k) > u, for small lambda
+            int_t invert(real_t u) const
+            {
+                int_t k = guide[int(u * guide_size)];
+                while (cdf_table[k] <= u)
+                    k++;
+                return k;
+            }
+
+            // Transformed rejection with squeeze (Hormann, 1993), the first attempt uses the given uniforms
+            template <typename G>
+            int_t ptrs(G& rng, real_t u, real_t v) const
+            {
+                for (;;)
+                {
+                    u -= 0.5;
+                    real_t us = 0.5 - fabs(u);
+                    real_t k = floor((2 * a / us + b) * u + l + 0.43);
+                    if (us >= 0.07 && v <= vr)
+                        return int_t(k);
+                    if (k >= 0 && (us >= 0.013 || v <= us) &&
+                        log(v * invalpha / (a / (us * us) + b)) <= -l + k * loglam - log_factorial(k))
+                        return int_t(k);
+
+                    u = rng.next_unit();
+                    v = rng.next_unit();
+                }
+            }
         public:
             /// @brief Constructor for the Poisson Distribution
             /// @param lambda lambda (> 0)
             Poisson(real_t lambda);
 
             /// @brief Returns the next value of the random variable described by the distribution
-            /// @param rng A random number generator (derived from DiceForge::Generator) 
-            template <typename T>
-            int_t next(DiceForge::Generator<T>& rng)
+            /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937) 
+            /// @note Takes O(1) expected time, by table inversion for lambda < 10 and transformed rejection (Hormann's PTRS) otherwise
+            template <typename G>
+            int_t next(G& rng) const
             {
-                real_t t,x,c;
-                do{
-                    do{
-                        t=tan(M_PI*rng.next_unit());
-                        x=sq*t+l;
-                    } while (x<0);
-                    x=floor(x);
-                    c=0.9*(1+t*t)*exp(x*lnl-lgamma(x+1)-g);
-                } while(rng.next_unit()>c);
-
-                return int_t(x);
+                auto&& g = as_generator(rng);
+                real_t u = g.next_unit();
+                if (l < inversion_limit)
+                    return invert(u);
+                real_t v = g.next_unit();
+                return ptrs(g, u, v);
             }
 
+            /// @brief Fills the given array with values of the random variable described by the distribution
+            /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+            /// @param out array to fill
+            /// @param n number of values to generate
+            /// @note The uniform random numbers are drawn in bulk through Generator::fill_unit
+            template <typename G>
+            void sample_n(G& rng, int_t* out, size_t n) const
+            {
+                auto&& g = as_generator(rng);
+                constexpr size_t block = 256;
+                real_t u[2 * block];
+                while (n > 0)
+                {
+                    size_t len = std::min(n, block);
+                    if (l < inversion_limit)
+                    {
+                        g.fill_unit(u, len);
+                        for (size_t k = 0; k < len; k++)
+                            out[k] = invert(u[k]);
+                    }
+                    else
+                    {
+                        g.fill_unit(u, 2 * len);
+                        for (size_t k = 0; k < len; k++)
+                            out[k] = ptrs(g, u[2 * k], u[2 * k + 1]);
+                    }
+                    out += len;
+                    n -= len;
+                }
+            }
+
+            /// @brief DiceForge::Poisson::Sampler - Draws from the distribution through its cdf table or its rejection constants
+            class Sampler {
+                private:
+                    friend class Poisson;
+                    const Poisson* dist;
+                public:
+                    /// @brief Returns the next value of the random variable described by the distribution
+                    /// @param rng A random number generator (a DiceForge RNG or any UniformRandomBitGenerator, such as std::mt19937)
+                    template <typename G>
+                    int_t operator()(G& rng) const
+                    {
+                        return dist->next(rng);
+                    }
+            };
+            /// @brief Returns a sampler of the distribution, for drawing many values with the same parameters
+            /// @note The sampler refers to the distribution, which must outlive it
+            Sampler prepare() const;
+
             /// @brief Returns the theoretical variance of the distribution
             real_t variance() const override;
 
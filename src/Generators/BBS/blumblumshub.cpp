@@ -1,77 +1,165 @@
 #include "blumblumshub.h"
-#include <numeric>
 
 namespace DiceForge
 {
-    const uint64_t BlumBlumShub32::p = 4294967291;
-    const uint64_t BlumBlumShub32::q = 4294967279;
-    const uint64_t BlumBlumShub32::n = BlumBlumShub32::p*BlumBlumShub32::q;
-
-    const uint64_t BlumBlumShub64::p = 4294967291;
-    const uint64_t BlumBlumShub64::q = 4294967279;
-    const uint64_t BlumBlumShub64::n = BlumBlumShub64::p*BlumBlumShub64::q;
-
-    inline void BlumBlumShub32::propagate(){
-        state.square();
-        state.mod(n);
-
-        // Ensure the state is not 0 or 1
-        if((state.data[0] == 0 || state.data[0] == 1)&& state.data[1] != 0){
-            state.data[0] += 429496737ULL; // A random constant to avoid getting stuck at 0 or 1
-            state.data[1] += state.data[0] >> 32;
-            state.data[0] &= 0xFFFFFFFF;
+    // Default modulus, product of the primes 4294967291 and 4294967279 (both 3 mod 4)
+    static const uint64_t default_modulus[1] = {4294967291ULL * 4294967279ULL};
+
+    // Builds the Montgomery context of n = p * q, p and q being given as 64-bit limbs
+    static Montgomery make_modulus(const std::vector<uint64_t>& p, const std::vector<uint64_t>& q)
+    {
+        if (p.empty() || q.empty() || (p[0] & 3) != 3 || (q[0] & 3) != 3)
+            throw std::invalid_argument("Blum-Blum-Shub primes must be 3 mod 4!");
+        if (p.size() + q.size() > size_t(Montgomery::max_limbs))
+            throw std::invalid_argument("Blum-Blum-Shub modulus must not exceed 512 bits!");
+
+        size_t lp = p.size(), lq = q.size();
+        while (lp > 1 && p[lp - 1] == 0) lp--;
+        while (lq > 1 && q[lq - 1] == 0) lq--;
+        if (lp == lq && std::equal(p.begin(), p.begin() + lp, q.begin()))
+            throw std::invalid_argument("Blum-Blum-Shub primes must be distinct!");
+
+        uint64_t n[Montgomery::max_limbs] = {};
+        for (size_t i = 0; i < lp; i++) {
+            uint128_t c = 0;
+            for (size_t j = 0; j < lq; j++) {
+                c += uint128_t(p[i]) * q[j] + n[i + j];
+                n[i + j] = uint64_t(c);
+                c >>= 64;
+            }
+            n[i + lq] = uint64_t(c);
+        }
+        return Montgomery(n, int(lp + lq));
+    }
+
+    // floor(log2(log2(n))), the number of bits that can be safely extracted per squaring
+    static int default_bits(const Montgomery& modulus)
+    {
+        int bits = 0;
+        for (int length = modulus.bit_length(); length > 1; length >>= 1)
+            bits++;
+        return bits;
+    }
+
+    // Multi-limb case of square_state, kept out of line so that the single-limb case stays in registers
+    __attribute__((noinline))
+    static uint64_t square_state_wide(const Montgomery& modulus, uint64_t* state)
+    {
+        uint64_t x[Montgomery::max_limbs];
+        modulus.mul(state, state, state);
+        modulus.from_montgomery(state, x);
+        return x[0];
+    }
+
+    // Squares the state (in Montgomery form) modulo n, returns the lowest limb of the new state in normal form
+    static inline uint64_t square_state(const Montgomery& modulus, uint64_t* state)
+    {
+        if (modulus.limbs == 1) {
+            state[0] = modulus.mul64(state[0], state[0]);
+            return modulus.from_montgomery64(state[0]);
+        }
+        return square_state_wide(modulus, state);
+    }
+
+    // Sets the state to seed^2 mod n, moving on to the next seed while the state would be stuck at 0 or 1
+    static void seed_state(const Montgomery& modulus, uint64_t* state, uint64_t seed)
+    {
+        for (;; seed++) {
+            uint64_t x[Montgomery::max_limbs] = {};
+            x[0] = modulus.limbs == 1 ? seed % modulus.n[0] : seed;
+            modulus.to_montgomery(x, state);
+            modulus.mul(state, state, state);
+            modulus.from_montgomery(state, x);
+
+            bool stuck = x[0] <= 1;
+            for (int i = 1; i < modulus.limbs; i++)
+                stuck = stuck && x[i] == 0;
+            if (!stuck)
+                return;
         }
     }
 
-    BlumBlumShub32::BlumBlumShub32(uint32_t seed): state(0, 0, 0, 0){
+    BlumBlumShub32::BlumBlumShub32(uint32_t seed): modulus(default_modulus, 1){
+        bits = default_bits(modulus);
+        mask = (1ULL << bits) - 1;
         reseed(seed);
     }
 
+    BlumBlumShub32::BlumBlumShub32(uint32_t seed, const std::vector<uint64_t>& p, const std::vector<uint64_t>& q, int bits): modulus(make_modulus(p, q)){
+        if (bits < 0 || bits > 32)
+            throw std::invalid_argument("Number of bits extracted per squaring must be between 1 and 32!");
+        this->bits = bits == 0 ? default_bits(modulus) : bits;
+        mask = (1ULL << this->bits) - 1;
+        reseed(seed);
+    }
+
+    inline uint64_t BlumBlumShub32::propagate(){
+        return square_state(modulus, state) & mask;
+    }
+
     uint32_t BlumBlumShub32::generate() {
-        uint32_t num = 0;
-        for(int i = 0; i < 4; i++){
-            propagate();
-            num = (num << 8) | (state.data[0] & 0xFF); // Extracting LSB and appending
+        // Collect the extracted bits until there are enough for one number
+        while (pool_bits < 32) {
+            pool |= uint64_t(propagate()) << pool_bits;
+            pool_bits += bits;
         }
+        uint32_t num = uint32_t(pool);
+        pool >>= 32;
+        pool_bits -= 32;
         return num;
     }
 
-    void BlumBlumShub32::reseed(uint32_t seed) {
-        for(int i = 1; i < 4; i++)
-            state.data[i] = 0;
-        state.data[0] = seed;
+    void BlumBlumShub32::generate_block(uint32_t* out, size_t n) {
+        for(size_t k = 0; k < n; k++){
+            out[k] = BlumBlumShub32::generate();
+        }
     }
 
-    inline void BlumBlumShub64::propagate(){
-        state.square();
-        state.mod(n);
+    void BlumBlumShub32::reseed(uint32_t seed) {
+        seed_state(modulus, state, seed);
+        pool = 0;
+        pool_bits = 0;
+    }
 
-        // Ensure the state is not 0 or 1
-        if((state.data[0] == 0 || state.data[0] == 1)&& state.data[1] != 0){
-            state.data[0] += 429496737ULL; // A random constant to avoid getting stuck at 0 or 1
-            state.data[1] += state.data[0] >> 32;
-            state.data[0] &= 0xFFFFFFFF;
-        }
+    BlumBlumShub64::BlumBlumShub64(uint64_t seed): modulus(default_modulus, 1){
+        bits = default_bits(modulus);
+        mask = (1ULL << bits) - 1;
+        reseed(seed);
     }
 
-    BlumBlumShub64::BlumBlumShub64(uint64_t seed): state(0, 0, 0, 0){
+    BlumBlumShub64::BlumBlumShub64(uint64_t seed, const std::vector<uint64_t>& p, const std::vector<uint64_t>& q, int bits): modulus(make_modulus(p, q)){
+        if (bits < 0 || bits > 32)
+            throw std::invalid_argument("Number of bits extracted per squaring must be between 1 and 32!");
+        this->bits = bits == 0 ? default_bits(modulus) : bits;
+        mask = (1ULL << this->bits) - 1;
         reseed(seed);
     }
 
+    inline uint64_t BlumBlumShub64::propagate(){
+        return square_state(modulus, state) & mask;
+    }
+
     uint64_t BlumBlumShub64::generate() {
-        uint64_t num = 0;
-        for(int i = 0; i < 8; i++){
-            propagate();
-            num = (num << 8) | (state.data[0] & 0xFF); // Extracting LSB and appending
+        // Collect the extracted bits until there are enough for one number
+        while (pool_bits < 64) {
+            pool |= uint128_t(propagate()) << pool_bits;
+            pool_bits += bits;
         }
+        uint64_t num = uint64_t(pool);
+        pool >>= 64;
+        pool_bits -= 64;
         return num;
     }
 
-    void BlumBlumShub64::reseed(uint64_t seed) {
-        for(int i = 2; i < 4; i++)
-            state.data[i] = 0;
-        state.data[1] = seed >> 32;
-        state.data[0] = seed & 0xFFFFFFFF;
+    void BlumBlumShub64::generate_block(uint64_t* out, size_t n) {
+        for(size_t k = 0; k < n; k++){
+            out[k] = BlumBlumShub64::generate();
+        }
     }
 
-}
\ No newline at end of file
+    void BlumBlumShub64::reseed(uint64_t seed) {
+        seed_state(modulus, state, seed);
+        pool = 0;
+        pool_bits = 0;
+    }
+}
@@ -9,20 +9,25 @@ namespace DiceForge
     /**
      * @brief DiceForge::BlumBlumShub32 - A RNG utilizing the Blum-Blum-Shub algorithm
      * for generating 32-bit unsigned random integers
+     *
+     * The modulus n = p * q is handled with Montgomery arithmetic, and the lowest
+     * log2(log2(n)) bits of the state are extracted per squaring by default
      */
     class BlumBlumShub32 : public Generator<uint32_t>
     {
         private:
-            static const uint64_t p;
-            static const uint64_t q;
-            static const uint64_t n;
-
-            BigInt128 state; // Internal state
+            Montgomery modulus; // Montgomery context of the modulus n = p * q
+            uint64_t state[Montgomery::max_limbs]; // Internal state, in Montgomery form
+            int bits; // Number of bits extracted per squaring
+            uint64_t mask; // Mask of the extracted bits
+            uint64_t pool; // Extracted bits not returned yet
+            int pool_bits; // Number of bits in pool
 
             /**
              * @brief propagate - Advances the internal state using the Blum-Blum-Shub algorithm
+             * @return The extracted bits of the new state
              */
-            inline void propagate();
+            inline uint64_t propagate();
 
             /**
              * @brief generate - Generates a random number using the Blum-Blum-Shub algorithm
@@ -37,6 +42,13 @@ namespace DiceForge
              */
             void reseed(uint32_t seed) override;
 
+            /**
+             * @brief generate_block - Generates n random numbers using the Blum-Blum-Shub algorithm
+             * @param out The buffer to write the generated numbers to
+             * @param n The number of random numbers to generate
+             */
+            void generate_block(uint32_t* out, size_t n) override;
+
         public:
             /**
              * @brief Constructor for BlumBlumShub32
@@ -45,6 +57,19 @@ namespace DiceForge
              */
             BlumBlumShub32(uint32_t seed);
 
+            /**
+             * @brief Constructor for BlumBlumShub32 with a custom modulus
+             * @param seed The initial seed value
+             * @param p First prime factor of the modulus, as 64-bit limbs (least significant first)
+             * @param q Second prime factor of the modulus, as 64-bit limbs (least significant first)
+             * @param bits Number of bits extracted per squaring (1 to 32), zero for log2(log2(n))
+             * @throws std::invalid_argument if p or q is not 3 mod 4, if p = q, if n = p * q exceeds 512 bits
+             * or if bits is out of range
+             * @note p and q are not tested for primality, extracting more than log2(log2(n)) bits
+             * per squaring trades the security of the generator for speed
+             */
+            BlumBlumShub32(uint32_t seed, const std::vector<uint64_t>& p, const std::vector<uint64_t>& q, int bits = 0);
+
             /**
              * @brief Destructor for BlumBlumShub32
              */
@@ -54,20 +79,25 @@ namespace DiceForge
     /**
      * @brief DiceForge::BlumBlumShub64 - A RNG utilizing the Blum-Blum-Shub algorithm
      * for generating 64-bit unsigned random integers
+     *
+     * The modulus n = p * q is handled with Montgomery arithmetic, and the lowest
+     * log2(log2(n)) bits of the state are extracted per squaring by default
      */
     class BlumBlumShub64 : public Generator<uint64_t>
     {
         private:
-            static const uint64_t p;
-            static const uint64_t q;
-            static const uint64_t n;
-
-            BigInt128 state; // Internal state
+            Montgomery modulus; // Montgomery context of the modulus n = p * q
+            uint64_t state[Montgomery::max_limbs]; // Internal state, in Montgomery form
+            int bits; // Number of bits extracted per squaring
+            uint64_t mask; // Mask of the extracted bits
+            uint128_t pool; // Extracted bits not returned yet
+            int pool_bits; // Number of bits in pool
 
             /**
              * @brief propagate - Advances the internal state using the Blum-Blum-Shub algorithm
+             * @return The extracted bits of the new state
              */
-            inline void propagate();
+            inline uint64_t propagate();
 
             /**
              * @brief generate - Generates a random number using the Blum-Blum-Shub algorithm
@@ -82,6 +112,13 @@ namespace DiceForge
              */
             void reseed(uint64_t seed) override;
 
+            /**
+             * @brief generate_block - Generates n random numbers using the Blum-Blum-Shub algorithm
+             * @param out The buffer to write the generated numbers to
+             * @param n The number of random numbers to generate
+             */
+            void generate_block(uint64_t* out, size_t n) override;
+
         public:
             /**
              * @brief Constructor for BlumBlumShub64
@@ -90,6 +127,19 @@ namespace DiceForge
              */
             BlumBlumShub64(uint64_t seed);
 
+            /**
+             * @brief Constructor for BlumBlumShub64 with a custom modulus
+             * @param seed The initial seed value
+             * @param p First prime factor of the modulus, as 64-bit limbs (least significant first)
+             * @param q Second prime factor of the modulus, as 64-bit limbs (least significant first)
+             * @param bits Number of bits extracted per squaring (1 to 32), zero for log2(log2(n))
+             * @throws std::invalid_argument if p or q is not 3 mod 4, if p = q, if n = p * q exceeds 512 bits
+             * or if bits is out of range
+             * @note p and q are not tested for primality, extracting more than log2(log2(n)) bits
+             * per squaring trades the security of the generator for speed
+             */
+            BlumBlumShub64(uint64_t seed, const std::vector<uint64_t>& p, const std::vector<uint64_t>& q, int bits = 0);
+
             /**
              * @brief Destructor for BlumBlumShub64
              */
@@ -0,0 +1,72 @@
+#include "Halton.h"
+#include "../XORShift/XORShift.h"
+#include <stdexcept>
+
+namespace DiceForge
+{
+    Halton::Halton(size_t dimension, Scrambling scrambling, uint64_t seed) : QuasiGenerator(dimension)
+    {
+        if (dimension == 0){
+            throw std::invalid_argument("Dimension of Halton sequences must be positive!");
+        }
+        if (scrambling == Scrambling::owen){
+            throw std::invalid_argument("Owen scrambling is only available for Sobol sequences!");
+        }
+
+        // The first primes, by trial division
+        for (uint32_t p = 2; m_base.size() < dimension; p++)
+        {
+            bool prime = true;
+            for (uint32_t q : m_base)
+            {
+                if (q * q > p)
+                    break;
+                if (p % q == 0) {
+                    prime = false;
+                    break;
+                }
+            }
+            if (prime)
+                m_base.push_back(p);
+        }
+
+        if (scrambling == Scrambling::shift)
+        {
+            // Zero stays in place, so that the infinitely many leading zeros of every index still add nothing
+            XORShift64 rng = XORShift64(seed);
+            m_permutation.resize(dimension);
+            for (size_t d = 0; d < dimension; d++)
+            {
+                m_permutation[d].resize(m_base[d]);
+                for (uint32_t j = 0; j < m_base[d]; j++)
+                    m_permutation[d][j] = j;
+                rng.shuffle(m_permutation[d].begin() + 1, m_permutation[d].end());
+            }
+        }
+    }
+
+    void Halton::generate(real_t* point)
+    {
+        uint64_t k = index() + 1;
+        for (size_t d = 0; d < dims; d++)
+        {
+            uint32_t p = m_base[d];
+            real_t inv = real_t(1) / p, f = inv, x = 0;
+            for (uint64_t j = k; j > 0; j /= p)
+            {
+                uint32_t digit = uint32_t(j % p);
+                if (!m_permutation.empty())
+                    digit = m_permutation[d][digit];
+                x += digit * f;
+                f *= inv;
+            }
+            point[d] = x;
+        }
+    }
+
+    void Halton::seek(uint64_t i)
+    {
+        // Every point is computed from its index, there is no state to move
+        (void)i;
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef DF_HALTON_H
+#define DF_HALTON_H
+
+#include "generator.h"
+
+namespace DiceForge
+{
+    /// @brief DiceForge::Halton - Halton low-discrepancy sequence, coordinate d being the radical inverse
+    /// of the index of the point in the d-th prime base
+    /// @note Starts from index one, so every point is in (0, 1)^d. Any point is computed directly from its index,
+    /// in O(d log n) time. Its projections on pairs of coordinates of large bases are poor, which scrambling mends
+    class Halton : public QuasiGenerator
+    {
+    private:
+        std::vector<uint32_t> m_base;                       // Prime base of every coordinate
+        std::vector<std::vector<uint32_t>> m_permutation;   // Permutation of the digits of every coordinate, empty without scrambling
+        void generate(real_t* point) override;
+        void seek(uint64_t i) override;
+    public:
+        /// @brief Initializes the Halton sequence at its first point
+        /// @param dimension number of coordinates of every point
+        /// @param scrambling Scrambling::none or Scrambling::shift (a random permutation of the non-zero digits of every base)
+        /// @param seed seed of the scrambling, if it is zero the current system time is used (not used without scrambling)
+        Halton(size_t dimension, Scrambling scrambling = Scrambling::none, uint64_t seed = 0);
+        /// @brief Default destructor
+        ~Halton() = default;
+    };
+}
+
+#endif
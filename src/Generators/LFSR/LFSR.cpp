@@ -3,26 +3,63 @@
 
 namespace DiceForge
 {
+    /* The 128-bit register (curr_seed1 : curr_seed2) shifts right by one bit per step, the new
+    * leftmost bit being the XOR of bits 0, 1, 2 and 7. Since all four taps lie in the lower word,
+    * the next 64 feedback bits only depend on bits already in the register and can be computed
+    * in one go, which advances the register by a whole word per step. */
+
+    // Number of bit steps skipped while reseeding, the register is the reversed seed before that
+    static constexpr int warmup_words = 102;
+
+    // Advances the register by 64 bit steps
+    static inline void lfsr_step64(uint64_t& hi, uint64_t& lo)
+    {
+        uint64_t feedback = lo ^ ((lo >> 1) | (hi << 63)) ^ ((lo >> 2) | (hi << 62)) ^ ((lo >> 7) | (hi << 57));
+        lo = hi;
+        hi = feedback;
+    }
+
+    // Advances the register by 32 bit steps
+    static inline void lfsr_step32(uint64_t& hi, uint64_t& lo)
+    {
+        uint64_t feedback = lo ^ (lo >> 1) ^ (lo >> 2) ^ (lo >> 7);
+        lo = (lo >> 32) | (hi << 32);
+        hi = (hi >> 32) | (feedback << 32);
+    }
+
+    // The bit-serial generator appended the oldest bit first, i.e. as the most significant one
+    static inline uint64_t reverse_bits(uint64_t x)
+    {
+        x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+        x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+        x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+        x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+        x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);
+        return (x >> 32) | (x << 32);
+    }
+
     LFSR64::LFSR64(uint64_t seed)
     {
         reseed(seed);
     }
 
     uint64_t LFSR64::generate() {
-        uint64_t rand_num = 0;
-        uint64_t new_bit;
+        // The output bits are the ones that reach the right end of the register, oldest first
+        uint64_t rand_num = reverse_bits((curr_seed2 >> 1) | (curr_seed1 << 63));
+        lfsr_step64(curr_seed1, curr_seed2);
+        return rand_num * 0x2545F4914F6CDD1DULL;
+    }
 
-        // For each bit to generate in rand_num,
-        for (int i = 0; i < 64; i++) {
-            // Calculate (by the series of taps) the new bit to be added to left of curr_seed
-            new_bit = (curr_seed2 ^ (curr_seed2 >> 1) ^ (curr_seed2 >> 2) ^ (curr_seed2 >> 7)) & 1;
-            // Shift curr_seed (both parts) to the right, and change the leftmost bit to new_bit
-            curr_seed2 = (curr_seed2 >> 1) | (curr_seed1 << 63);
-            curr_seed1 = (curr_seed1 >> 1) | (new_bit << 63);
-            // Take the last bit of curr_seed as the output, and add it to the right of rand_num
-            rand_num = rand_num * 2 + (curr_seed2 & 1);
+    void LFSR64::generate_block(uint64_t* out, size_t n) {
+        // Same recurrence as generate(), on local copies of the register
+        uint64_t s1 = curr_seed1, s2 = curr_seed2;
+        for (size_t k = 0; k < n; k++) {
+            uint64_t rand_num = reverse_bits((s2 >> 1) | (s1 << 63));
+            lfsr_step64(s1, s2);
+            out[k] = rand_num * 0x2545F4914F6CDD1DULL;
         }
-        return rand_num * 0x2545F4914F6CDD1DULL;
+        curr_seed1 = s1;
+        curr_seed2 = s2;
     }
 
     void LFSR64::reseed(uint64_t seed) {
@@ -37,11 +74,9 @@ namespace DiceForge
             curr_seed2 = seed;
         }
         // Important: First 128 bits generated will simply be curr_seed in reverse
-        // Get them out of the way while reseeding
-        generate();
-        generate();
-        for (int i = 0; i < 100; i++){
-            generate();
+        // Get them out of the way while reseeding, a whole word at a time
+        for (int i = 0; i < warmup_words; i++){
+            lfsr_step64(curr_seed1, curr_seed2);
         }
     }
 
@@ -51,20 +86,22 @@ namespace DiceForge
     }
 
     uint32_t DiceForge::LFSR32::generate() {
-        uint32_t rand_num = 0;
-        uint64_t new_bit;
+        // The output bits are the ones that reach the right end of the register, oldest first
+        uint32_t rand_num = reverse_bits(curr_seed2 >> 1) >> 32;
+        lfsr_step32(curr_seed1, curr_seed2);
+        return rand_num * 0x2545F4914F6CDD1DULL;
+    }
 
-        // For each bit to generate in rand_num,
-        for (int i = 0; i < 32; i++) {
-            // Calculate (by the series of taps) the new bit to be added to left of curr_seed
-            new_bit = (curr_seed2 ^ (curr_seed2 >> 1) ^ (curr_seed2 >> 2) ^ (curr_seed2 >> 7)) & 1;
-            // Shift curr_seed (both parts) to the right, and change the leftmost bit to new_bit
-            curr_seed2 = (curr_seed2 >> 1) | (curr_seed1 << 63);
-            curr_seed1 = (curr_seed1 >> 1) | (new_bit << 63);
-            // Take the last bit of curr_seed as the output, and add it to the right of rand_num
-            rand_num = rand_num * 2 + (curr_seed2 & 1);
+    void LFSR32::generate_block(uint32_t* out, size_t n) {
+        // Same recurrence as generate(), on local copies of the register
+        uint64_t s1 = curr_seed1, s2 = curr_seed2;
+        for (size_t k = 0; k < n; k++) {
+            uint32_t rand_num = reverse_bits(s2 >> 1) >> 32;
+            lfsr_step32(s1, s2);
+            out[k] = rand_num * 0x2545F4914F6CDD1DULL;
         }
-        return rand_num * 0x2545F4914F6CDD1DULL;
+        curr_seed1 = s1;
+        curr_seed2 = s2;
     }
 
     void LFSR32::reseed(uint32_t seed) {
@@ -80,14 +117,9 @@ namespace DiceForge
             curr_seed2 = (s << 32) | s;
         }
         // Important: First 128 bits generated will simply be curr_seed in reverse
-        // Get them out of the way while reseeding
-        generate();
-        generate();
-        generate();
-        generate();
-            
-        for (int i = 0; i < 200; i++){
-            generate();
+        // Get them out of the way while reseeding, a whole word at a time
+        for (int i = 0; i < warmup_words; i++){
+            lfsr_step64(curr_seed1, curr_seed2);
         }
     }
-}
\ No newline at end of file
+}
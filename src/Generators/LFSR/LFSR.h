@@ -14,6 +14,8 @@ namespace DiceForge {
         uint64_t generate() override;
         // Function to reseed the RNG
         void reseed(uint64_t seed) override;
+        // Function to generate n random 64-bit positive integers at once
+        void generate_block(uint64_t* out, size_t n) override;
     public:
         /// @brief Initializes the LFSR with the specified seed
         /// @param seed seed to initialize the RNG with
@@ -34,6 +36,8 @@ namespace DiceForge {
         /// @brief Function to reseed the RNG
         /// @note if the seed provided is zero, then the current system time is taken as seed
         void reseed(uint32_t seed) override;
+        // Function to generate n random 32-bit positive integers at once
+        void generate_block(uint32_t* out, size_t n) override;
     public:    
         /// @brief Initializes the LFSR with the specified seed
         /// @param seed seed to initialize the RNG with
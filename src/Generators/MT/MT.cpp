@@ -1,8 +1,186 @@
 #include "MT.h"
 
+#if defined(__x86_64__) || defined(__i386__)
+#define DF_MT_X86 1
+#include <immintrin.h>
+#endif
+
 namespace DiceForge
 {
-    
+    /* State regeneration (twist) kernels
+    *
+    * Within one pass the recurrence only reads words that have not been rewritten yet,
+    * or words rewritten at least N - M positions earlier, so neighbouring words can be
+    * twisted side by side in SIMD registers. Every kernel leaves exactly the same state
+    * behind as the scalar one, the widest one supported by the CPU is picked at runtime. */
+
+    template <typename UInt>
+    using twist_fn = void (*)(UInt* mt, UInt A, UInt upper, UInt lower);
+
+    // Twists a single word, (y & 1) selects A without a table lookup or a branch
+    template <typename UInt>
+    static inline UInt twist_word(UInt cur, UInt next, UInt far, UInt A, UInt upper, UInt lower)
+    {
+        UInt y = (cur & upper) | (next & lower);
+        return far ^ (y >> 1) ^ ((UInt(0) - (y & 1)) & A);
+    }
+
+    // Portable kernel, one word at a time
+    template <typename UInt, int N, int M>
+    static void twist_scalar(UInt* mt, UInt A, UInt upper, UInt lower)
+    {
+        int k;
+        for (k = 0; k < N - M; k++)
+            mt[k] = twist_word(mt[k], mt[k + 1], mt[k + M], A, upper, lower);
+        for (; k < N - 1; k++)
+            mt[k] = twist_word(mt[k], mt[k + 1], mt[k + M - N], A, upper, lower);
+        mt[N - 1] = twist_word(mt[N - 1], mt[0], mt[M - 1], A, upper, lower);
+    }
+
+#if DF_MT_X86
+
+    // 128-bit kernel, 4 (MT32) or 2 (MT64) words per step
+    template <typename UInt>
+    __attribute__((target("sse2")))
+    static inline __m128i twist_sse2_step(__m128i cur, __m128i next, __m128i far, __m128i A, __m128i upper, __m128i lower)
+    {
+        __m128i y = _mm_or_si128(_mm_and_si128(cur, upper), _mm_and_si128(next, lower));
+        __m128i shifted, mask;
+        if constexpr (sizeof(UInt) == 4)
+        {
+            shifted = _mm_srli_epi32(y, 1);
+            mask = _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(y, _mm_set1_epi32(1)));
+        }
+        else
+        {
+            shifted = _mm_srli_epi64(y, 1);
+            mask = _mm_sub_epi64(_mm_setzero_si128(), _mm_and_si128(y, _mm_set1_epi64x(1)));
+        }
+        return _mm_xor_si128(_mm_xor_si128(far, shifted), _mm_and_si128(mask, A));
+    }
+
+    template <typename UInt, int N, int M>
+    __attribute__((target("sse2")))
+    static void twist_sse2(UInt* mt, UInt A, UInt upper, UInt lower)
+    {
+        constexpr int W = sizeof(__m128i) / sizeof(UInt);
+        __m128i vA, vU, vL;
+        if constexpr (sizeof(UInt) == 4)
+        {
+            vA = _mm_set1_epi32(A);
+            vU = _mm_set1_epi32(upper);
+            vL = _mm_set1_epi32(lower);
+        }
+        else
+        {
+            vA = _mm_set1_epi64x(A);
+            vU = _mm_set1_epi64x(upper);
+            vL = _mm_set1_epi64x(lower);
+        }
+
+        int k = 0;
+        for (; k + W <= N - M; k += W)
+        {
+            __m128i cur = _mm_loadu_si128((const __m128i*)(mt + k));
+            __m128i next = _mm_loadu_si128((const __m128i*)(mt + k + 1));
+            __m128i far = _mm_loadu_si128((const __m128i*)(mt + k + M));
+            _mm_storeu_si128((__m128i*)(mt + k), twist_sse2_step<UInt>(cur, next, far, vA, vU, vL));
+        }
+        for (; k < N - M; k++)
+            mt[k] = twist_word(mt[k], mt[k + 1], mt[k + M], A, upper, lower);
+
+        for (; k + W <= N - 1; k += W)
+        {
+            __m128i cur = _mm_loadu_si128((const __m128i*)(mt + k));
+            __m128i next = _mm_loadu_si128((const __m128i*)(mt + k + 1));
+            __m128i far = _mm_loadu_si128((const __m128i*)(mt + k + M - N));
+            _mm_storeu_si128((__m128i*)(mt + k), twist_sse2_step<UInt>(cur, next, far, vA, vU, vL));
+        }
+        for (; k < N - 1; k++)
+            mt[k] = twist_word(mt[k], mt[k + 1], mt[k + M - N], A, upper, lower);
+
+        mt[N - 1] = twist_word(mt[N - 1], mt[0], mt[M - 1], A, upper, lower);
+    }
+
+    // 256-bit kernel, 8 (MT32) or 4 (MT64) words per step
+    template <typename UInt>
+    __attribute__((target("avx2")))
+    static inline __m256i twist_avx2_step(__m256i cur, __m256i next, __m256i far, __m256i A, __m256i upper, __m256i lower)
+    {
+        __m256i y = _mm256_or_si256(_mm256_and_si256(cur, upper), _mm256_and_si256(next, lower));
+        __m256i shifted, mask;
+        if constexpr (sizeof(UInt) == 4)
+        {
+            shifted = _mm256_srli_epi32(y, 1);
+            mask = _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_and_si256(y, _mm256_set1_epi32(1)));
+        }
+        else
+        {
+            shifted = _mm256_srli_epi64(y, 1);
+            mask = _mm256_sub_epi64(_mm256_setzero_si256(), _mm256_and_si256(y, _mm256_set1_epi64x(1)));
+        }
+        return _mm256_xor_si256(_mm256_xor_si256(far, shifted), _mm256_and_si256(mask, A));
+    }
+
+    template <typename UInt, int N, int M>
+    __attribute__((target("avx2")))
+    static void twist_avx2(UInt* mt, UInt A, UInt upper, UInt lower)
+    {
+        constexpr int W = sizeof(__m256i) / sizeof(UInt);
+        __m256i vA, vU, vL;
+        if constexpr (sizeof(UInt) == 4)
+        {
+            vA = _mm256_set1_epi32(A);
+            vU = _mm256_set1_epi32(upper);
+            vL = _mm256_set1_epi32(lower);
+        }
+        else
+        {
+            vA = _mm256_set1_epi64x(A);
+            vU = _mm256_set1_epi64x(upper);
+            vL = _mm256_set1_epi64x(lower);
+        }
+
+        int k = 0;
+        for (; k + W <= N - M; k += W)
+        {
+            __m256i cur = _mm256_loadu_si256((const __m256i*)(mt + k));
+            __m256i next = _mm256_loadu_si256((const __m256i*)(mt + k + 1));
+            __m256i far = _mm256_loadu_si256((const __m256i*)(mt + k + M));
+            _mm256_storeu_si256((__m256i*)(mt + k), twist_avx2_step<UInt>(cur, next, far, vA, vU, vL));
+        }
+        for (; k < N - M; k++)
+            mt[k] = twist_word(mt[k], mt[k + 1], mt[k + M], A, upper, lower);
+
+        for (; k + W <= N - 1; k += W)
+        {
+            __m256i cur = _mm256_loadu_si256((const __m256i*)(mt + k));
+            __m256i next = _mm256_loadu_si256((const __m256i*)(mt + k + 1));
+            __m256i far = _mm256_loadu_si256((const __m256i*)(mt + k + M - N));
+            _mm256_storeu_si256((__m256i*)(mt + k), twist_avx2_step<UInt>(cur, next, far, vA, vU, vL));
+        }
+        for (; k < N - 1; k++)
+            mt[k] = twist_word(mt[k], mt[k + 1], mt[k + M - N], A, upper, lower);
+
+        mt[N - 1] = twist_word(mt[N - 1], mt[0], mt[M - 1], A, upper, lower);
+    }
+
+#endif
+
+    // Picks the widest kernel supported by the CPU we are running on
+    template <typename UInt, int N, int M>
+    static twist_fn<UInt> select_twist()
+    {
+#if DF_MT_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return twist_avx2<UInt, N, M>;
+        if (__builtin_cpu_supports("sse2"))
+            return twist_sse2<UInt, N, M>;
+#endif
+        return twist_scalar<UInt, N, M>;
+    }
+
     // Constructor for 32-bit random number.
     MT32::MT32(uint32_t _seed)
     {
@@ -10,19 +188,6 @@ namespace DiceForge
             _seed = time(NULL);
 
         seed = _seed;
-
-        N = 624;
-        M = 397;
-        A = 2573724191;
-        upperbits = 0x80000000;
-        lowerbits = (int32_t)0x7ffffffff;
-        tempering_mask_B = 0x9d2c5680;
-        tempering_mask_C = 0xefc60000;
-        tempering_shift_U = 11;
-        tempering_shift_S = 7;
-        tempering_shift_T = 15;
-        tempering_shift_L = 18;
-        mt.resize(N);
         reseed(seed);
     }
 
@@ -45,6 +210,23 @@ namespace DiceForge
         return y;
     }
 
+    // Bulk generation, tempers whole runs of the state vector between regenerations.
+    void MT32::generate_block(uint32_t* out, size_t n)
+    {
+        while (n > 0)
+        {
+            trytransform();
+            size_t len = std::min(n, size_t(N - mti));
+            for (size_t i = 0; i < len; i++)
+            {
+                out[i] = temper(mt[mti + i]);
+            }
+            mti += len;
+            out += len;
+            n -= len;
+        }
+    }
+
     // Generates initial vector.
     void MT32::sgenrand(uint32_t iniseed)
     {
@@ -58,24 +240,9 @@ namespace DiceForge
     // If mti>=N, MT algorithm is run to regenerate values.
     void MT32::trytransform(){
         if (mti >= N){
-            
-            uint32_t mtrx[2] = {0, A};
-            uint32_t y; // A temperory variable.
-            int k; // An iterative variable
-
-            for (k = 0; k < N - M; k++)
-            {
-                y = (mt[k] & upperbits) | (mt[k + 1] & lowerbits); // Performing the linear reccurence transformation
-                mt[k] = mt[k + M] ^ (y >> 1) ^ (mtrx[y & 1]);
-            }
-            for (; k < N - 1; k++)
-            {
-                y = (mt[k] & upperbits) | (mt[k + 1] & lowerbits);
-                mt[k] = mt[k + M - N] ^ (y >> 1) ^ (mtrx[y & 1]);
-            }
-
-            y = (mt[N - 1] & upperbits) | (mt[0] & lowerbits);
-            mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ (mtrx[y & 1]);
+            // Performing the linear reccurence transformation with the fastest available kernel
+            static const twist_fn<uint32_t> twist = select_twist<uint32_t, N, M>();
+            twist(mt, A, upperbits, lowerbits);
 
             mti = 0;
         }
@@ -99,19 +266,6 @@ namespace DiceForge
             _seed = time(NULL);
 
         seed = _seed;
-
-        N = 312;
-        M = 156;
-        A = 0xB5026F5AA96619E9;
-        upperbits = 0xFFFFFFFF80000000ULL;
-        lowerbits = 0x7FFFFFFFULL;
-        tempering_mask_B = 0xD66B5EF5B4DA0000;
-        tempering_mask_C = 0xFDED6BE000000000;
-        tempering_shift_U = 29;
-        tempering_shift_S = 17;
-        tempering_shift_T = 37;
-        tempering_shift_L = 41;
-        mt.resize(N);
         reseed(seed);
     }
 
@@ -134,6 +288,23 @@ namespace DiceForge
         return y;
     }
 
+    // Bulk generation, tempers whole runs of the state vector between regenerations.
+    void MT64::generate_block(uint64_t* out, size_t n)
+    {
+        while (n > 0)
+        {
+            trytransform();
+            size_t len = std::min(n, size_t(N - mti));
+            for (size_t i = 0; i < len; i++)
+            {
+                out[i] = temper(mt[mti + i]);
+            }
+            mti += len;
+            out += len;
+            n -= len;
+        }
+    }
+
     // Generates initial vector.
     void MT64::sgenrand(uint64_t iniseed)
     {
@@ -147,24 +318,9 @@ namespace DiceForge
     // If mti>=N, MT algorithm is run to regenerate values.
     void MT64::trytransform(){
         if (mti >= N){
-            
-            uint64_t mtrx[2] = {0, A};
-            uint64_t y; // A temperory variable.
-            int k; // An iterative variable
-
-            for (k = 0; k < N - M; k++)
-            {
-                y = (mt[k] & upperbits) | (mt[k + 1] & lowerbits); // Performing the linear reccurence transformation
-                mt[k] = mt[k + M] ^ (y >> 1) ^ (mtrx[y & 1]);
-            }
-            for (; k < N - 1; k++)
-            {
-                y = (mt[k] & upperbits) | (mt[k + 1] & lowerbits);
-                mt[k] = mt[k + M - N] ^ (y >> 1) ^ (mtrx[y & 1]);
-            }
-
-            y = (mt[N - 1] & upperbits) | (mt[0] & lowerbits);
-            mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ (mtrx[y & 1]);
+            // Performing the linear reccurence transformation with the fastest available kernel
+            static const twist_fn<uint64_t> twist = select_twist<uint64_t, N, M>();
+            twist(mt, A, upperbits, lowerbits);
 
             mti = 0;
         }
@@ -179,4 +335,215 @@ namespace DiceForge
         y ^= (y >> tempering_shift_L);
         return y;
     }
+
+    /* Jump ahead for MT64
+    *
+    * The word recurrence is linear over GF(2), so advancing the state window by J words is
+    * the same as evaluating g(x) = x^J mod phi(x) at the one-word transition, where phi is
+    * the characteristic polynomial of the recurrence. phi is recovered once, with
+    * Berlekamp-Massey, from a bit sequence produced by the recurrence itself. */
+
+    typedef std::vector<uint64_t> gf2poly; // bit (i % 64) of word (i / 64) is the coefficient of x^i
+
+    static inline bool poly_bit(const gf2poly& p, size_t i)
+    {
+        return (p[i >> 6] >> (i & 63)) & 1;
+    }
+
+    static size_t poly_degree(const gf2poly& p)
+    {
+        for (size_t k = p.size(); k-- > 0;)
+            if (p[k] != 0)
+                return k * 64 + 63 - __builtin_clzll(p[k]);
+        return 0;
+    }
+
+    // dst ^= src * x^shift
+    static void poly_xor_shifted(gf2poly& dst, const gf2poly& src, size_t shift)
+    {
+        size_t q = shift >> 6, r = shift & 63;
+        for (size_t k = 0; k < src.size() && k + q < dst.size(); k++)
+        {
+            dst[k + q] ^= src[k] << r;
+            if (r != 0 && k + q + 1 < dst.size())
+                dst[k + q + 1] ^= src[k] >> (64 - r);
+        }
+    }
+
+    // Interleaves zeros between the bits of x, i.e. squares x as a polynomial
+    static inline uint64_t spread_bits(uint32_t x)
+    {
+        uint64_t v = x;
+        v = (v | (v << 16)) & 0x0000FFFF0000FFFFULL;
+        v = (v | (v << 8)) & 0x00FF00FF00FF00FFULL;
+        v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        v = (v | (v << 2)) & 0x3333333333333333ULL;
+        v = (v | (v << 1)) & 0x5555555555555555ULL;
+        return v;
+    }
+
+    // p = p^2 mod phi, where phi has degree d
+    static void poly_sqrmod(gf2poly& p, const gf2poly& phi, size_t d)
+    {
+        gf2poly sq(2 * p.size(), 0);
+        for (size_t k = 0; k < p.size(); k++)
+        {
+            sq[2 * k] = spread_bits(uint32_t(p[k]));
+            sq[2 * k + 1] = spread_bits(uint32_t(p[k] >> 32));
+        }
+        for (size_t i = sq.size() * 64 - 1; i >= d; i--)
+        {
+            if (poly_bit(sq, i))
+                poly_xor_shifted(sq, phi, i - d);
+        }
+        sq.resize(p.size());
+        p = sq;
+    }
+
+    // p = p * x mod phi, where phi has degree d
+    static void poly_mulx_mod(gf2poly& p, const gf2poly& phi, size_t d)
+    {
+        for (size_t k = p.size() - 1; k > 0; k--)
+            p[k] = (p[k] << 1) | (p[k - 1] >> 63);
+        p[0] <<= 1;
+        if (poly_bit(p, d))
+            poly_xor_shifted(p, phi, 0);
+    }
+
+    // x^(n * 2^squarings) mod phi, where phi has degree d
+    static gf2poly poly_xpow(uint64_t n, unsigned squarings, const gf2poly& phi, size_t d)
+    {
+        gf2poly g(d / 64 + 1, 0);
+        g[0] = 1;
+        for (int b = 63 - __builtin_clzll(n | 1); b >= 0; b--)
+        {
+            poly_sqrmod(g, phi, d);
+            if ((n >> b) & 1)
+                poly_mulx_mod(g, phi, d);
+        }
+        for (unsigned i = 0; i < squarings; i++)
+            poly_sqrmod(g, phi, d);
+        return g;
+    }
+
+    // Characteristic polynomial of the recurrence with the given parameters, computed on first use
+    template <int N, int M>
+    static const gf2poly& charpoly(uint64_t A, uint64_t upper, uint64_t lower)
+    {
+        static const gf2poly phi = [&]()
+        {
+            // The state has less than N * 64 bits, twice as many sample bits pin down the polynomial
+            const size_t len = 2 * N * 64;
+            const size_t words = len / 64 + 2;
+
+            // Sample s_j = lowest bit of the j-th word, stored in reverse so that the
+            // discrepancy below is a dot product with a shifted window of it
+            uint64_t st[N];
+            st[0] = 5489;
+            for (int i = 1; i < N; i++)
+                st[i] = (st[i - 1] * 69069) & 0x7FFFFFFFULL;
+            gf2poly rev(words, 0);
+            for (size_t j = 0; j < len; j++)
+            {
+                if (j % N == 0)
+                    twist_scalar<uint64_t, N, M>(st, A, upper, lower);
+                if (st[j % N] & 1)
+                    rev[(len - 1 - j) >> 6] |= 1ULL << ((len - 1 - j) & 63);
+            }
+
+            // Berlekamp-Massey, C is the connection polynomial: sum_{i = 0}^{L} C_i s_{n - i} = 0
+            gf2poly C(words, 0), B(words, 0);
+            C[0] = B[0] = 1;
+            size_t L = 0, m = 1;
+            for (size_t n = 0; n < len; n++)
+            {
+                // s_{n - i} is bit (len - 1 - n + i) of rev
+                size_t o = len - 1 - n, q = o >> 6, r = o & 63;
+                uint64_t d = 0;
+                for (size_t k = 0; k <= (L >> 6) && k + q < words; k++)
+                {
+                    uint64_t w = rev[k + q] >> r;
+                    if (r != 0 && k + q + 1 < words)
+                        w |= rev[k + q + 1] << (64 - r);
+                    d ^= C[k] & w;
+                }
+
+                if (__builtin_parityll(d) && 2 * L <= n)
+                {
+                    gf2poly T = C;
+                    poly_xor_shifted(C, B, m);
+                    L = n + 1 - L;
+                    B = T;
+                    m = 1;
+                }
+                else
+                {
+                    if (__builtin_parityll(d))
+                        poly_xor_shifted(C, B, m);
+                    m++;
+                }
+            }
+
+            // The characteristic polynomial is the reciprocal of C
+            gf2poly phi(L / 64 + 1, 0);
+            for (size_t i = 0; i <= L; i++)
+            {
+                if (poly_bit(C, i))
+                    phi[(L - i) >> 6] |= 1ULL << ((L - i) & 63);
+            }
+            return phi;
+        }();
+        return phi;
+    }
+
+    // Replaces the state window by g(T) applied to it, T being the one-word step of the recurrence
+    void MT64::jump_window(const std::vector<uint64_t>& g, size_t terms)
+    {
+        // buf is a circular window over the words, stepped one word at a time
+        uint64_t buf[N], acc[N] = {0};
+        std::copy(mt, mt + N, buf);
+        int s = 0;
+        for (size_t i = 0; i < terms; i++)
+        {
+            if (poly_bit(g, i))
+            {
+                for (int j = 0; j < N - s; j++)
+                    acc[j] ^= buf[s + j];
+                for (int j = N - s; j < N; j++)
+                    acc[j] ^= buf[s + j - N];
+            }
+            buf[s] = twist_word(buf[s], buf[(s + 1) % N], buf[(s + M) % N], A, upperbits, lowerbits);
+            s = (s + 1) % N;
+        }
+        std::copy(acc, acc + N, mt);
+    }
+
+    void MT64::jump(uint64_t n)
+    {
+        // Words are only ever consumed from a regenerated state, which is what the jump acts on
+        trytransform();
+
+        const gf2poly& phi = charpoly<N, M>(A, upperbits, lowerbits);
+        size_t d = poly_degree(phi);
+        if (n < d)
+        {
+            // x^n is already reduced, so this only steps through n words
+            gf2poly g(n / 64 + 1, 0);
+            g[n >> 6] = 1ULL << (n & 63);
+            jump_window(g, n + 1);
+        }
+        else
+        {
+            jump_window(poly_xpow(n, 0, phi, d), d);
+        }
+    }
+
+    void MT64::long_jump()
+    {
+        trytransform();
+
+        const gf2poly& phi = charpoly<N, M>(A, upperbits, lowerbits);
+        static const gf2poly g = poly_xpow(1, 128, phi, poly_degree(phi));
+        jump_window(g, poly_degree(phi));
+    }
 }
@@ -16,19 +16,20 @@ namespace DiceForge{
     {
     private:
         // Main Parameters:
-        int N;                          // length of state value vector
-        int M;                          // optimum value as mid
-        uint32_t A;                     // vector in the matrix A
-        uint32_t upperbits, lowerbits;  // for obtaining first w-r bits of the number
+        static constexpr int N = 624;                       // length of state value vector
+        static constexpr int M = 397;                       // optimum value as mid
+        static constexpr uint32_t A = 2573724191;           // vector in the matrix A
+        static constexpr uint32_t upperbits = 0x80000000;   // for obtaining first w-r bits of the number
+        static constexpr uint32_t lowerbits = 0xFFFFFFFF;   // (int32_t)0x7ffffffff, kept as is so that streams do not change
         // Tempering Parameters:
-        uint32_t tempering_mask_B;
-        uint32_t tempering_mask_C;
-        uint32_t tempering_shift_U;
-        uint32_t tempering_shift_S;
-        uint32_t tempering_shift_T;
-        uint32_t tempering_shift_L;
+        static constexpr uint32_t tempering_mask_B = 0x9d2c5680;
+        static constexpr uint32_t tempering_mask_C = 0xefc60000;
+        static constexpr uint32_t tempering_shift_U = 11;
+        static constexpr uint32_t tempering_shift_S = 7;
+        static constexpr uint32_t tempering_shift_T = 15;
+        static constexpr uint32_t tempering_shift_L = 18;
         // Other Parameters:
-        std::vector<uint32_t> mt;       // State Vector
+        alignas(32) uint32_t mt[N];     // State Vector
         int mti;                // Used as index for the array MT.
         uint32_t seed;                  // Seed given from main
         // Funtcions to generate first N pseudo-random numbers as a seed for the algorithm.
@@ -37,6 +38,7 @@ namespace DiceForge{
         uint32_t temper(uint32_t);
         uint32_t generate() override;
         void reseed(uint32_t seed) override;
+        void generate_block(uint32_t* out, size_t n) override;
     public:
         /// @brief Initializes the Mersenne Twister RNG with the specified seed
         /// @param seed seed to initialize the RNG with
@@ -50,19 +52,20 @@ namespace DiceForge{
     {
     private:
         // Main Parameters:
-        int N;                          // length of state value vector
-        int M;                          // optimum value as mid
-        uint64_t A;                     // vector in the matrix A
-        uint64_t upperbits, lowerbits;  // for obtaining first w-r bits of the number
+        static constexpr int N = 312;                                   // length of state value vector
+        static constexpr int M = 156;                                   // optimum value as mid
+        static constexpr uint64_t A = 0xB5026F5AA96619E9;               // vector in the matrix A
+        static constexpr uint64_t upperbits = 0xFFFFFFFF80000000ULL;    // for obtaining first w-r bits of the number
+        static constexpr uint64_t lowerbits = 0x7FFFFFFFULL;
         // Tempering Parameters:
-        uint64_t tempering_mask_B;
-        uint64_t tempering_mask_C;
-        uint64_t tempering_shift_U;
-        uint64_t tempering_shift_S;
-        uint64_t tempering_shift_T;
-        uint64_t tempering_shift_L;
+        static constexpr uint64_t tempering_mask_B = 0xD66B5EF5B4DA0000;
+        static constexpr uint64_t tempering_mask_C = 0xFDED6BE000000000;
+        static constexpr uint64_t tempering_shift_U = 29;
+        static constexpr uint64_t tempering_shift_S = 17;
+        static constexpr uint64_t tempering_shift_T = 37;
+        static constexpr uint64_t tempering_shift_L = 41;
         // Other Parameters:
-        std::vector<uint64_t> mt;       // State Vector
+        alignas(32) uint64_t mt[N];     // State Vector
         int mti;                // Used as index for the array MT.
         uint64_t seed;                  // Seed given from main
         // Funtcions to generate first N pseudo-random numbers as a seed for the algorithm.
@@ -71,12 +74,22 @@ namespace DiceForge{
         uint64_t temper(uint64_t);
         uint64_t generate() override;
         void reseed(uint64_t seed) override;
+        void generate_block(uint64_t* out, size_t n) override;
+        // Replaces the state by g(T) applied to it, T being the one-word step of the recurrence
+        void jump_window(const std::vector<uint64_t>& g, size_t terms);
     public:
         /// @brief Initializes the Mersenne Twister RNG with the specified seed
         /// @param seed seed to initialize the RNG with
         /// @note if the seed provided is zero, then the current system time is taken as seed
         MT64(uint64_t seed);
         ~MT64() = default;
+        /// @brief Advances the RNG by n steps, as if next() had been called n times
+        /// @param n number of steps to skip
+        /// @note Works in O(log n) polynomial operations, no numbers are generated and discarded
+        void jump(uint64_t n);
+        /// @brief Advances the RNG by 2^128 steps
+        /// @note Repeated long jumps from one seed split it into non-overlapping substreams of 2^128 numbers each
+        void long_jump();
     };
     
     // Typedef for convenience
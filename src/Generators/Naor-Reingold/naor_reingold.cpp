@@ -1,4 +1,3 @@
-
 #include "naor_reingold.h"
 #include <chrono>
 
@@ -18,7 +17,7 @@ static constexpr ull a[] = {
 
 namespace DiceForge {
 
-  ull power(ull a, ull b, ull mod) {
+  constexpr ull power(ull a, ull b, ull mod) {
     ull result = 1;
     ull a_pwr = a % mod;
     while (b) {
@@ -32,11 +31,40 @@ namespace DiceForge {
     return result;
   }
 
+  // Number of low state bits covered by the lookup table of the batched path
+  static constexpr int low_bits = 8;
+
+  // Constants of the PRF, all computed at compile time
+  struct NaorReingoldTables {
+    ull factor[32];             // g^a[i] mod p, multiplied in when bit i of the state is set
+    ull step[31];               // factor[k] / (factor[0] * ... * factor[k-1]) mod p, applied when m_state++ carries into bit k
+    ull low[1 << low_bits];     // Product of the factors of the set bits of every low_bits-bit number
+
+    constexpr NaorReingoldTables() : factor(), step(), low() {
+      for (int i = 0; i < 32; i++)
+        factor[i] = power(g, a[i], p);
+
+      // p is prime, so the inverse of x is x^(p - 2)
+      ull cleared = 1;
+      for (int k = 0; k < 31; k++) {
+        step[k] = factor[k] * power(cleared, p - 2, p) % p;
+        cleared = cleared * factor[k] % p;
+      }
+
+      for (int x = 0; x < (1 << low_bits); x++) {
+        low[x] = 1;
+        for (int i = 0; i < low_bits; i++) {
+          if (x & (1 << i))
+            low[x] = low[x] * factor[i] % p;
+        }
+      }
+    }
+  };
+
+  static constexpr NaorReingoldTables tables;
+
   NaorReingold::NaorReingold(uint32_t seed) {
-    if (seed == 0)
-      m_state = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-    else
-      m_state = seed;
+    reseed(seed);
   }
 
   void NaorReingold::reseed(uint32_t seed) { 
@@ -44,20 +72,54 @@ namespace DiceForge {
       m_state = std::chrono::high_resolution_clock::now().time_since_epoch().count();
     else
       m_state = seed;
+    m_product = evaluate(m_state);
   }
 
-  uint32_t NaorReingold::generate() {
+  uint32_t NaorReingold::evaluate(uint64_t x) const {
     ull res = 1;
     for (int i = 0; i < 32; i++) {
       // Only multiply the remainder if the corresponding bit is 1
-      bool to_multiply = m_state & (1 << i);
+      // (1 << i) is an int, so bit 31 stands for all bits from 31 upwards
+      bool to_multiply = x & (1 << i);
 
       if (to_multiply)
-        res = (res * power(g, a[i], p)) % p;
+        res = (res * tables.factor[i]) % p;
     }
+    return res;
+  }
+
+  uint32_t NaorReingold::generate() {
+    uint32_t res = m_product;
+
+    // m_state++ clears the trailing ones and sets the bit above them, so a single
+    // multiplication updates the product unless the carry reaches bit 31
+    uint64_t carry = ~m_state & 0x7FFFFFFF;
+    if (carry)
+      m_product = (m_product * tables.step[__builtin_ctzll(carry)]) % p;
+    else
+      m_product = evaluate(m_state + 1);
 
     m_state++;
     return res;
   }
 
+  void NaorReingold::generate_block(uint32_t* out, size_t n) {
+    // Consecutive states only differ in their low bits, so each run of states sharing the upper
+    // bits needs one product for the upper bits and independent table lookups for the low bits
+    const uint64_t low_mask = (1ULL << low_bits) - 1;
+    uint64_t state = m_state;
+    while (n > 0) {
+      ull high = evaluate(state & ~low_mask);
+      size_t run = std::min<size_t>(n, (low_mask + 1) - (state & low_mask));
+      for (size_t i = 0; i < run; i++)
+        out[i] = (high * tables.low[(state & low_mask) + i]) % p;
+
+      out += run;
+      n -= run;
+      state += run;
+    }
+    m_state = state;
+    m_product = evaluate(m_state);
+  }
+
 } // namespace DiceForge
@@ -9,8 +9,10 @@ namespace DiceForge {
   class NaorReingold : public Generator<uint32_t> {
     private:
       uint64_t m_state;   // Internal state
+      uint32_t m_product;  // Output for the current state
       uint32_t generate() override;
       void reseed(uint32_t seed) override;
+      void generate_block(uint32_t* out, size_t n) override;
       
     public:
       /// @brief Initializes the PRF with the given seed
@@ -20,6 +22,10 @@ namespace DiceForge {
       NaorReingold(uint32_t seed);
       /// @brief Default destructor
       ~NaorReingold() = default;
+      /// @brief Evaluates the PRF at the given point, irrespective of the state of the generator
+      /// @param x point to evaluate the PRF at
+      /// @return The number the generator returns when its state is x
+      uint32_t evaluate(uint64_t x) const;
 };
 
   typedef NaorReingold NaorReingold32;
@@ -0,0 +1,180 @@
+#include "Philox.h"
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define DF_PHILOX_X86 1
+#include <immintrin.h>
+#endif
+
+namespace DiceForge
+{
+    // Round multipliers and Weyl key increments of Philox4x32
+    static constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+    static constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+    static constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+    static constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+    static constexpr int PHILOX_ROUNDS = 10;
+
+    typedef void (*philox_kernel)(const uint32_t* key, uint64_t* counter, uint64_t* out, size_t blocks);
+
+    // Encrypts one 128-bit counter, out receives the two 64-bit numbers of the block
+    static inline void philox_block(const uint32_t* key, const uint64_t* counter, uint64_t* out)
+    {
+        uint32_t c0 = uint32_t(counter[0]), c1 = uint32_t(counter[0] >> 32);
+        uint32_t c2 = uint32_t(counter[1]), c3 = uint32_t(counter[1] >> 32);
+        uint32_t k0 = key[0], k1 = key[1];
+
+        for (int r = 0; r < PHILOX_ROUNDS; r++)
+        {
+            uint64_t p0 = uint64_t(PHILOX_M0) * c0;
+            uint64_t p1 = uint64_t(PHILOX_M1) * c2;
+            c0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+            c1 = uint32_t(p1);
+            c2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+            c3 = uint32_t(p0);
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+
+        out[0] = (uint64_t(c1) << 32) | c0;
+        out[1] = (uint64_t(c3) << 32) | c2;
+    }
+
+    static inline void increment(uint64_t* counter)
+    {
+        if (++counter[0] == 0)
+            counter[1]++;
+    }
+
+    // Portable kernel, one block at a time
+    static void philox_scalar(const uint32_t* key, uint64_t* counter, uint64_t* out, size_t blocks)
+    {
+        for (size_t i = 0; i < blocks; i++)
+        {
+            philox_block(key, counter, out + 2 * i);
+            increment(counter);
+        }
+    }
+
+#if DF_PHILOX_X86
+
+    // 256-bit kernel, four independent counters per step, each 32-bit word in its own 64-bit lane
+    __attribute__((target("avx2")))
+    static void philox_avx2(const uint32_t* key, uint64_t* counter, uint64_t* out, size_t blocks)
+    {
+        const __m256i M0 = _mm256_set1_epi64x(PHILOX_M0);
+        const __m256i M1 = _mm256_set1_epi64x(PHILOX_M1);
+        const __m256i lo32 = _mm256_set1_epi64x(0xFFFFFFFF);
+
+        size_t i = 0;
+        for (; i + 4 <= blocks; i += 4)
+        {
+            uint64_t ctr[4][2];
+            for (int j = 0; j < 4; j++)
+            {
+                ctr[j][0] = counter[0];
+                ctr[j][1] = counter[1];
+                increment(counter);
+            }
+
+            __m256i c0 = _mm256_set_epi64x(ctr[3][0] & 0xFFFFFFFF, ctr[2][0] & 0xFFFFFFFF, ctr[1][0] & 0xFFFFFFFF, ctr[0][0] & 0xFFFFFFFF);
+            __m256i c1 = _mm256_set_epi64x(ctr[3][0] >> 32, ctr[2][0] >> 32, ctr[1][0] >> 32, ctr[0][0] >> 32);
+            __m256i c2 = _mm256_set_epi64x(ctr[3][1] & 0xFFFFFFFF, ctr[2][1] & 0xFFFFFFFF, ctr[1][1] & 0xFFFFFFFF, ctr[0][1] & 0xFFFFFFFF);
+            __m256i c3 = _mm256_set_epi64x(ctr[3][1] >> 32, ctr[2][1] >> 32, ctr[1][1] >> 32, ctr[0][1] >> 32);
+            uint32_t k0 = key[0], k1 = key[1];
+
+            for (int r = 0; r < PHILOX_ROUNDS; r++)
+            {
+                __m256i p0 = _mm256_mul_epu32(M0, c0);
+                __m256i p1 = _mm256_mul_epu32(M1, c2);
+                c0 = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(p1, 32), c1), _mm256_set1_epi64x(k0));
+                c1 = _mm256_and_si256(p1, lo32);
+                c2 = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(p0, 32), c3), _mm256_set1_epi64x(k1));
+                c3 = _mm256_and_si256(p0, lo32);
+                k0 += PHILOX_W0;
+                k1 += PHILOX_W1;
+            }
+
+            // a = first numbers of the four blocks, b = second numbers, stored interleaved
+            __m256i a = _mm256_or_si256(c0, _mm256_slli_epi64(c1, 32));
+            __m256i b = _mm256_or_si256(c2, _mm256_slli_epi64(c3, 32));
+            __m256i lo = _mm256_unpacklo_epi64(a, b);
+            __m256i hi = _mm256_unpackhi_epi64(a, b);
+            _mm256_storeu_si256((__m256i*)(out + 2 * i), _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256((__m256i*)(out + 2 * i + 4), _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+
+        philox_scalar(key, counter, out + 2 * i, blocks - i);
+    }
+
+#endif
+
+    // Picks the widest kernel supported by the CPU we are running on
+    static philox_kernel select_kernel()
+    {
+#if DF_PHILOX_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return philox_avx2;
+#endif
+        return philox_scalar;
+    }
+
+    Philox4x32::Philox4x32(uint64_t seed)
+    {
+        reseed(seed);
+    }
+
+    void Philox4x32::reseed(uint64_t seed)
+    {
+        if (seed == 0){
+            seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        }
+        set_key(seed);
+        set_counter(0, 0);
+    }
+
+    void Philox4x32::set_key(uint64_t key)
+    {
+        m_key[0] = uint32_t(key);
+        m_key[1] = uint32_t(key >> 32);
+        m_index = 2;
+    }
+
+    void Philox4x32::set_counter(uint64_t lo, uint64_t hi)
+    {
+        m_counter[0] = lo;
+        m_counter[1] = hi;
+        m_index = 2;
+    }
+
+    uint64_t Philox4x32::generate()
+    {
+        if (m_index == 2)
+        {
+            philox_block(m_key, m_counter, m_buffer);
+            increment(m_counter);
+            m_index = 0;
+        }
+        return m_buffer[m_index++];
+    }
+
+    void Philox4x32::generate_block(uint64_t* out, size_t n)
+    {
+        static const philox_kernel kernel = select_kernel();
+
+        // Use up what is left of the current block first
+        while (n > 0 && m_index < 2)
+        {
+            *out++ = m_buffer[m_index++];
+            n--;
+        }
+
+        kernel(m_key, m_counter, out, n / 2);
+
+        if (n % 2 == 1)
+        {
+            out[n - 1] = generate();
+        }
+    }
+}
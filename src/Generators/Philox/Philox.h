@@ -0,0 +1,43 @@
+#ifndef DF_PHILOX_H
+#define DF_PHILOX_H
+
+#include "generator.h"
+
+namespace DiceForge
+{
+    /// @brief DiceForge::Philox4x32 - A counter-based RNG following the Philox4x32-10 algorithm (Salmon et al.)
+    /// Each 128-bit counter is encrypted independently with the key into two 64-bit numbers,
+    /// so any position of the stream can be reached directly by setting the counter
+    /// @note Generates 64-bit unsigned integers
+    class Philox4x32 : public Generator<uint64_t>
+    {
+    private:
+        uint32_t m_key[2];          // Key of the bijection
+        uint64_t m_counter[2];      // Counter of the next block (low word, high word)
+        uint64_t m_buffer[2];       // Output of the current block
+        int m_index;                // Index of the next number in m_buffer (2 when it is used up)
+        uint64_t generate() override;
+        void reseed(uint64_t seed) override;
+        void generate_block(uint64_t* out, size_t n) override;
+    public:
+        /// @brief Initializes the Philox RNG with the specified seed as key and the counter at zero
+        /// @param seed seed to initialize the RNG with
+        /// @note If the given seed is zero, then the current system time is used as the seed
+        Philox4x32(uint64_t seed);
+        /// @brief Default destructor
+        ~Philox4x32() = default;
+        /// @brief Sets the key, the stream restarts from the current counter
+        /// @param key 64-bit key, every key gives an independent stream
+        void set_key(uint64_t key);
+        /// @brief Sets the 128-bit counter of the next block
+        /// @param lo lower 64 bits of the counter
+        /// @param hi upper 64 bits of the counter
+        /// @note Block i produces numbers 2i and 2i + 1 of the stream, so after set_counter(i) the next number
+        /// is number 2i of the stream, irrespective of what was generated before
+        void set_counter(uint64_t lo, uint64_t hi = 0);
+    };
+
+    typedef Philox4x32 Philox;
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef DF_SOBOL_H
+#define DF_SOBOL_H
+
+#include "generator.h"
+
+namespace DiceForge
+{
+    /// @brief DiceForge::Sobol - Sobol low-discrepancy sequence, with the direction numbers of Joe and Kuo
+    /// (new-joe-kuo-6.21201, which have good two-dimensional projections)
+    /// Consecutive points differ in one direction number per coordinate (gray code order), so each takes O(d) time
+    /// @note Holds up to 2^32 points of up to max_dimension coordinates, each point in (0, 1)^d as the
+    /// coordinates are centred in their cell of width 2^-32
+    class Sobol : public QuasiGenerator
+    {
+    private:
+        std::vector<uint32_t> m_direction;  // 32 direction numbers of every coordinate
+        std::vector<uint32_t> m_state;      // Coordinates of the next point, before scrambling
+        std::vector<uint32_t> m_scramble;   // Random shift or seed of the scrambling of every coordinate
+        Scrambling m_scrambling;
+        void generate(real_t* point) override;
+        void seek(uint64_t i) override;
+    public:
+        /// @brief Largest number of coordinates for which direction numbers are embedded
+        static constexpr size_t max_dimension = 1024;
+        /// @brief Initializes the Sobol sequence at its first point
+        /// @param dimension number of coordinates of every point, at most max_dimension
+        /// @param scrambling Scrambling::none, Scrambling::shift (random digital shift) or Scrambling::owen
+        /// (hash-based nested uniform scrambling of Laine and Karras)
+        /// @param seed seed of the scrambling, if it is zero the current system time is used (not used without scrambling)
+        Sobol(size_t dimension, Scrambling scrambling = Scrambling::none, uint64_t seed = 0);
+        /// @brief Default destructor
+        ~Sobol() = default;
+    };
+}
+
+#endif
@@ -26,6 +26,45 @@ namespace DiceForge
         return m_state * 0x2545F4914F6CDD1DULL;
     }
 
+    void XORShift32::generate_block(uint32_t* out, size_t n)
+    {
+        // Work on a local copy of the state so that it stays in a register
+        uint32_t s = m_state;
+        for (size_t i = 0; i < n; i++)
+        {
+            s ^= s << 13;
+            s ^= s >> 17;
+            s ^= s << 5;
+            out[i] = s * 0x2545F4914F6CDD1DULL;
+        }
+        m_state = s;
+    }
+
+    /* The xorshift step is linear over GF(2), so it is stored as a 64x64 bit matrix
+    * (column i is the image of bit i) and raised to a power by repeated squaring. */
+
+    // Returns m * v over GF(2)
+    static inline uint64_t bitmatrix_apply(const uint64_t* m, uint64_t v)
+    {
+        uint64_t r = 0;
+        for (int i = 0; i < 64; i++)
+        {
+            r ^= m[i] & (0 - ((v >> i) & 1));
+        }
+        return r;
+    }
+
+    // m = m * m over GF(2)
+    static inline void bitmatrix_square(uint64_t* m)
+    {
+        uint64_t sq[64];
+        for (int i = 0; i < 64; i++)
+        {
+            sq[i] = bitmatrix_apply(m, m[i]);
+        }
+        std::copy(sq, sq + 64, m);
+    }
+
     XORShift64::XORShift64(uint64_t seed)
     {
         reseed(seed);
@@ -48,4 +87,77 @@ namespace DiceForge
         m_state ^= m_state << 17;
         return m_state * 0x2545F4914F6CDD1DULL;
     }
+
+    void XORShift64::jump(uint64_t n)
+    {
+        // Matrix of a single step
+        uint64_t m[64];
+        for (int i = 0; i < 64; i++)
+        {
+            uint64_t s = 1ULL << i;
+            s ^= s << 13;
+            s ^= s >> 7;
+            s ^= s << 17;
+            m[i] = s;
+        }
+
+        // Powers of the same matrix commute, so the bits of n can be applied in any order
+        while (n > 0)
+        {
+            if (n & 1)
+                m_state = bitmatrix_apply(m, m_state);
+            n >>= 1;
+            if (n > 0)
+                bitmatrix_square(m);
+        }
+    }
+
+    void XORShift64::long_jump()
+    {
+        jump(1ULL << 48);
+    }
+
+    void XORShift64::generate_block(uint64_t* out, size_t n)
+    {
+        // Work on a local copy of the state so that it stays in a register
+        uint64_t s = m_state;
+        for (size_t i = 0; i < n; i++)
+        {
+            s ^= s << 13;
+            s ^= s >> 7;
+            s ^= s << 17;
+            out[i] = s * 0x2545F4914F6CDD1DULL;
+        }
+        m_state = s;
+    }
+
+    StaticXORShift32::StaticXORShift32(uint32_t seed)
+    {
+        reset_seed(seed);
+    }
+
+    void StaticXORShift32::reset_seed(uint32_t seed)
+    {
+        if (seed == 0){
+            m_state = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        }
+        else {
+            m_state = seed;
+        }
+    }
+
+    StaticXORShift64::StaticXORShift64(uint64_t seed)
+    {
+        reset_seed(seed);
+    }
+
+    void StaticXORShift64::reset_seed(uint64_t seed)
+    {
+        if (seed == 0){
+            m_state = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        }
+        else {
+            m_state = seed;
+        }
+    }
 }
\ No newline at end of file
@@ -15,6 +15,7 @@ namespace DiceForge
         uint32_t m_state;   // Internal state
         uint32_t generate() override;
         void reseed(uint32_t seed) override;
+        void generate_block(uint32_t* out, size_t n) override;
     public:
         /// @brief Initializes the XOR Shift RNG with the specified seed
         /// @param seed must be a non-zero number
@@ -34,6 +35,7 @@ namespace DiceForge
         uint64_t m_state;   // Internal state
         uint64_t generate() override;
         void reseed(uint64_t seed) override;
+        void generate_block(uint64_t* out, size_t n) override;
     public:
         /// @brief Initializes the XOR Shift RNG with the specified seed
         /// @param seed must be a non-zero number
@@ -41,9 +43,65 @@ namespace DiceForge
         XORShift64(uint64_t seed);
         /// @brief Default destructor
         ~XORShift64() = default;
+        /// @brief Advances the RNG by n steps, as if next() had been called n times
+        /// @param n number of steps to skip
+        /// @note Works in O(log n) 64x64 bit matrix operations, no numbers are generated and discarded
+        void jump(uint64_t n);
+        /// @brief Advances the RNG by 2^48 steps
+        /// @note Repeated long jumps from one seed split it into 2^16 non-overlapping substreams of 2^48 numbers each
+        void long_jump();
+    };
+
+    /// @brief DiceForge::StaticXORShift32 - The XORShift32 PRNG behind the static interface (DiceForge::StaticGenerator)
+    /// @note Generates the same numbers as XORShift32 from the same seed, but its calls can be inlined into the caller
+    class StaticXORShift32 : public StaticGenerator<uint32_t, StaticXORShift32>
+    {
+    private:
+        friend class StaticGenerator<uint32_t, StaticXORShift32>;
+        uint32_t m_state;   // Internal state
+        uint32_t generate()
+        {
+            m_state ^= m_state << 13;
+            m_state ^= m_state >> 17;
+            m_state ^= m_state << 5;
+            return m_state * 0x2545F4914F6CDD1DULL;
+        }
+    public:
+        /// @brief Initializes the XOR Shift RNG with the specified seed
+        /// @param seed must be a non-zero number
+        /// @note If the given seed is zero, then the current system is used as the seed
+        StaticXORShift32(uint32_t seed);
+        /// @brief Re-initializes the RNG with specified seed
+        /// @param seed seed provided for initialization
+        void reset_seed(uint32_t seed);
+    };
+
+    /// @brief DiceForge::StaticXORShift64 - The XORShift64 PRNG behind the static interface (DiceForge::StaticGenerator)
+    /// @note Generates the same numbers as XORShift64 from the same seed, but its calls can be inlined into the caller
+    class StaticXORShift64 : public StaticGenerator<uint64_t, StaticXORShift64>
+    {
+    private:
+        friend class StaticGenerator<uint64_t, StaticXORShift64>;
+        uint64_t m_state;   // Internal state
+        uint64_t generate()
+        {
+            m_state ^= m_state << 13;
+            m_state ^= m_state >> 7;
+            m_state ^= m_state << 17;
+            return m_state * 0x2545F4914F6CDD1DULL;
+        }
+    public:
+        /// @brief Initializes the XOR Shift RNG with the specified seed
+        /// @param seed must be a non-zero number
+        /// @note If the given seed is zero, then the current system is used as the seed
+        StaticXORShift64(uint64_t seed);
+        /// @brief Re-initializes the RNG with specified seed
+        /// @param seed seed provided for initialization
+        void reset_seed(uint64_t seed);
     };
 
     typedef XORShift64 XORShift;
+    typedef StaticXORShift64 StaticXORShift;
 }
 
 #endif
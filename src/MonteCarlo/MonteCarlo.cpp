@@ -0,0 +1,35 @@
+#include "MonteCarlo.h"
+
+namespace DiceForge
+{
+    void RunningStats::merge(const RunningStats& other)
+    {
+        if (other.n == 0)
+            return;
+        uint64_t total = n + other.n;
+        real_t delta = other.m - m;
+        m += delta * other.n / total;
+        s += other.s + delta * delta * (real_t(n) * other.n / total);
+        n = total;
+    }
+
+    uint64_t RunningStats::count() const
+    {
+        return n;
+    }
+
+    real_t RunningStats::mean() const
+    {
+        return m;
+    }
+
+    real_t RunningStats::variance() const
+    {
+        return n < 2 ? 0 : s / (n - 1);
+    }
+
+    real_t RunningStats::std_error() const
+    {
+        return n == 0 ? 0 : sqrt(variance() / n);
+    }
+}
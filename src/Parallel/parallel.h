@@ -0,0 +1,200 @@
+#ifndef DF_PARALLEL_H
+#define DF_PARALLEL_H
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+#include "generator.h"
+#include "../Generators/Philox/Philox.h"
+
+namespace DiceForge
+{
+    /// @brief Number of elements handled by one task of the parallel functions
+    /// @note Work is split into tasks of this size irrespective of the number of threads,
+    /// which is what makes the output independent of the number of threads
+    constexpr size_t parallel_block_size = 1 << 16;
+
+    /// @brief Runs f(0), f(1), ..., f(tasks - 1) on a pool of threads
+    /// @param tasks Number of tasks
+    /// @param threads Number of threads, zero for as many as the hardware runs concurrently
+    /// @param f Function taking the index of the task
+    /// @note Tasks are handed out in order to whichever thread is free, so f must not depend on the thread it runs on
+    template <typename F>
+    void parallel_for(size_t tasks, unsigned threads, F f)
+    {
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        if (threads > tasks)
+            threads = unsigned(tasks);
+
+        std::atomic<size_t> next_task(0);
+        auto worker = [&]() {
+            for (size_t t = next_task++; t < tasks; t = next_task++)
+                f(t);
+        };
+
+        std::vector<std::thread> pool;
+        for (unsigned i = 1; i < threads; i++)
+            pool.emplace_back(worker);
+        worker();
+        for (auto& thread : pool)
+            thread.join();
+    }
+
+    /// @brief Returns substream number 'stream' of the given seed
+    /// @param seed Key of the Philox RNG
+    /// @param stream Upper 64 bits of the counter, every stream holds 2^65 numbers
+    /// @note Unlike the constructor of Philox4x32, a zero seed is used as is
+    inline Philox4x32 substream(uint64_t seed, uint64_t stream)
+    {
+        Philox4x32 rng(1);
+        rng.set_key(seed);
+        rng.set_counter(0, stream);
+        return rng;
+    }
+
+    /// @brief Returns the seed itself, or the current system time if the seed is zero
+    inline uint64_t parallel_seed(uint64_t seed)
+    {
+        if (seed == 0)
+            seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        return seed;
+    }
+
+    /// @brief Fills the array with random 64-bit integers, generated in parallel
+    /// @param out Pointer to the first element
+    /// @param n Number of integers
+    /// @param seed Seed of the substreams, if it is zero the current system time is used
+    /// @param threads Number of threads, zero for as many as the hardware runs concurrently
+    /// @note Block b of parallel_block_size integers comes from substream(seed, b),
+    /// so the output only depends on the seed, not on the number of threads
+    inline void parallel_fill(uint64_t* out, size_t n, uint64_t seed, unsigned threads = 0)
+    {
+        seed = parallel_seed(seed);
+        size_t blocks = (n + parallel_block_size - 1) / parallel_block_size;
+        parallel_for(blocks, threads, [&](size_t b) {
+            Philox4x32 rng = substream(seed, b);
+            size_t start = b * parallel_block_size;
+            rng.fill(out + start, std::min(parallel_block_size, n - start));
+        });
+    }
+
+    /// @brief Fills the array with random real numbers in [0, 1), generated in parallel
+    /// @param out Pointer to the first element
+    /// @param n Number of real numbers
+    /// @param seed Seed of the substreams, if it is zero the current system time is used
+    /// @param threads Number of threads, zero for as many as the hardware runs concurrently
+    /// @note Same blocks and substreams as parallel_fill, so the output only depends on the seed
+    inline void parallel_fill_unit(real_t* out, size_t n, uint64_t seed, unsigned threads = 0)
+    {
+        seed = parallel_seed(seed);
+        size_t blocks = (n + parallel_block_size - 1) / parallel_block_size;
+        parallel_for(blocks, threads, [&](size_t b) {
+            Philox4x32 rng = substream(seed, b);
+            size_t start = b * parallel_block_size;
+            rng.fill_unit(out + start, std::min(parallel_block_size, n - start));
+        });
+    }
+
+    /// @brief Fills the sequence with samples, generated in parallel
+    /// @param first Iterator of first element (like .begin() of vectors)
+    /// @param last Iterator after last element (like .end() of vectors)
+    /// @param sampler A distribution's Sampler (from prepare()) or any callable taking a generator
+    /// @param seed Seed of the substreams, if it is zero the current system time is used
+    /// @param threads Number of threads, zero for as many as the hardware runs concurrently
+    /// @note The sampler is called from several threads at once, so it must not modify shared state
+    template <typename RandomAccessIterator, typename S>
+    void parallel_fill(RandomAccessIterator first, RandomAccessIterator last, const S& sampler, uint64_t seed, unsigned threads = 0)
+    {
+        seed = parallel_seed(seed);
+        size_t n = last - first;
+        size_t blocks = (n + parallel_block_size - 1) / parallel_block_size;
+        parallel_for(blocks, threads, [&](size_t b) {
+            Philox4x32 rng = substream(seed, b);
+            auto it = first + b * parallel_block_size;
+            auto end = first + std::min((b + 1) * parallel_block_size, n);
+            for (; it != end; it++)
+                *it = sampler(rng);
+        });
+    }
+
+    /// @brief Merges two shuffled sequences into one shuffled sequence, in place (MergeShuffle, Bacher et al.)
+    /// @param first Iterator of first element of the first sequence
+    /// @param mid Iterator of first element of the second sequence
+    /// @param last Iterator after last element of the second sequence
+    /// @param rng RNG used for the merge
+    /// @note Takes the next element from either sequence on a coin flip until one runs out,
+    /// the rest is placed by Fisher-Yates insertion
+    template <typename RandomAccessIterator, typename G>
+    void merge_shuffled(RandomAccessIterator first, RandomAccessIterator mid, RandomAccessIterator last, G& rng)
+    {
+        using std::swap;
+        RandomAccessIterator i = first, j = mid;
+        uint64_t bits = 0;
+        int count = 0;
+        while (true)
+        {
+            if (count == 0) {
+                bits = rng.next();
+                count = 8 * sizeof(rng.next());
+            }
+            bool flip = bits & 1;
+            bits >>= 1;
+            count--;
+
+            if (flip) {
+                if (j == last)
+                    break;
+                swap(*i, *j);
+                j++;
+            }
+            else if (i == j)
+                break;
+            i++;
+        }
+
+        for (; i != last; i++)
+            swap(*i, first[rng.next_in_range(0, i - first)]);
+    }
+
+    /// @brief Shuffles the sequence in place, in parallel
+    /// @param first Iterator of first element (like .begin() of vectors)
+    /// @param last Iterator after last element (like .end() of vectors)
+    /// @param seed Seed of the substreams, if it is zero the current system time is used
+    /// @param threads Number of threads, zero for as many as the hardware runs concurrently
+    /// @note MergeShuffle: the sequence is cut into a power of two of blocks of about parallel_block_size elements,
+    /// each block is shuffled on its own, then neighbouring blocks are merged pairwise with merge_shuffled until one is left.
+    /// Every block and every merge has its own substream, so the permutation only depends on the seed, not on the number of threads
+    template <typename RandomAccessIterator>
+    void parallel_shuffle(RandomAccessIterator first, RandomAccessIterator last, uint64_t seed, unsigned threads = 0)
+    {
+        seed = parallel_seed(seed);
+        size_t n = last - first;
+        size_t blocks = 1;
+        while (blocks * parallel_block_size < n)
+            blocks *= 2;
+
+        // Start of block b, blocks differ in size by at most one element
+        auto bound = [&](size_t b) {
+            return first + ((n / blocks) * b + (n % blocks) * b / blocks);
+        };
+
+        parallel_for(blocks, threads, [&](size_t b) {
+            Philox4x32 rng = substream(seed, b);
+            rng.shuffle_batched(bound(b), bound(b + 1));
+        });
+
+        for (size_t width = 1, level = 1; width < blocks; width *= 2, level++)
+        {
+            parallel_for(blocks / (2 * width), threads, [&](size_t p) {
+                Philox4x32 rng = substream(seed, (uint64_t(level) << 56) | p);
+                merge_shuffled(bound(2 * p * width), bound((2 * p + 1) * width), bound((2 * p + 2) * width), rng);
+            });
+        }
+    }
+}
+
+#endif
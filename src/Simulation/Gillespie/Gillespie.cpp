@@ -0,0 +1,238 @@
+#include "Gillespie.h"
+#include <stdexcept>
+#include <algorithm>
+
+namespace DiceForge
+{
+    ReactionNetwork::ReactionNetwork(size_t species) : n_species(species) {}
+
+    void ReactionNetwork::check_species(size_t s) const
+    {
+        if (s >= n_species){
+            throw std::invalid_argument("Species must be less than the number of species!");
+        }
+    }
+
+    size_t ReactionNetwork::add_reaction(real_t rate, const stoichiometry_t& reactants, const stoichiometry_t& products)
+    {
+        if (!(rate >= 0)){
+            throw std::invalid_argument("Rate constant must be non-negative!");
+        }
+        Reaction reaction;
+        reaction.rate = rate;
+        std::vector<int_t> change(n_species, 0);
+        for (auto& [s, n] : reactants){
+            check_species(s);
+            if (n <= 0){
+                throw std::invalid_argument("Stoichiometric coefficients must be positive!");
+            }
+            reaction.reactants.push_back({s, n});
+            reaction.reads.push_back(s);
+            change[s] -= n;
+        }
+        for (auto& [s, n] : products){
+            check_species(s);
+            if (n <= 0){
+                throw std::invalid_argument("Stoichiometric coefficients must be positive!");
+            }
+            change[s] += n;
+        }
+        for (size_t s = 0; s < n_species; s++){
+            if (change[s] != 0)
+                reaction.change.push_back({s, change[s]});
+        }
+        add(std::move(reaction));
+        return list.size() - 1;
+    }
+
+    size_t ReactionNetwork::add_reaction(propensity_t propensity, const std::vector<size_t>& reads, const stoichiometry_t& change)
+    {
+        Reaction reaction;
+        reaction.rate = 0;
+        reaction.custom = propensity;
+        for (size_t s : reads){
+            check_species(s);
+            reaction.reads.push_back(s);
+        }
+        for (auto& [s, n] : change){
+            check_species(s);
+            if (n != 0)
+                reaction.change.push_back({s, n});
+        }
+        add(std::move(reaction));
+        return list.size() - 1;
+    }
+
+    void ReactionNetwork::add(Reaction reaction)
+    {
+        // Reaction q depends on reaction r if r changes a species that the propensity of q reads
+        auto affects = [](const Reaction& r, const Reaction& q) {
+            for (auto& c : r.change){
+                if (std::find(q.reads.begin(), q.reads.end(), c.first) != q.reads.end())
+                    return true;
+            }
+            return false;
+        };
+        size_t index = list.size();
+        list.push_back(std::move(reaction));
+        depends.push_back({index});
+        for (size_t q = 0; q < index; q++){
+            if (affects(list[q], list[index]))
+                depends[q].push_back(index);
+            if (affects(list[index], list[q]))
+                depends[index].push_back(q);
+        }
+    }
+
+    size_t ReactionNetwork::species() const
+    {
+        return n_species;
+    }
+
+    size_t ReactionNetwork::reactions() const
+    {
+        return list.size();
+    }
+
+    real_t ReactionNetwork::propensity(size_t r, const state_t& x) const
+    {
+        const Reaction& reaction = list[r];
+        if (reaction.custom)
+            return reaction.custom(x);
+
+        // k times the product of the binomial coefficients C(x_s, n_s)
+        real_t a = reaction.rate;
+        for (auto& [s, n] : reaction.reactants){
+            if (x[s] < n)
+                return 0;
+            for (int_t i = 0; i < n; i++)
+                a *= real_t(x[s] - i) / real_t(i + 1);
+        }
+        return a;
+    }
+
+    void ReactionNetwork::fire(size_t r, state_t& x) const
+    {
+        for (auto& [s, n] : list[r].change)
+            x[s] += n;
+    }
+
+    const std::vector<size_t>& ReactionNetwork::dependents(size_t r) const
+    {
+        return depends[r];
+    }
+
+    IndexedPriorityQueue::IndexedPriorityQueue(const std::vector<real_t>& keys) : keys(keys), heap(keys.size()), position(keys.size())
+    {
+        for (size_t i = 0; i < keys.size(); i++){
+            heap[i] = i;
+            position[i] = i;
+        }
+        for (size_t p = keys.size() / 2; p-- > 0;)
+            sift_down(p);
+    }
+
+    size_t IndexedPriorityQueue::top() const
+    {
+        return heap[0];
+    }
+
+    real_t IndexedPriorityQueue::key(size_t i) const
+    {
+        return keys[i];
+    }
+
+    void IndexedPriorityQueue::update(size_t i, real_t key)
+    {
+        real_t old = keys[i];
+        keys[i] = key;
+        if (key < old)
+            sift_up(position[i]);
+        else
+            sift_down(position[i]);
+    }
+
+    void IndexedPriorityQueue::swap_places(size_t a, size_t b)
+    {
+        std::swap(heap[a], heap[b]);
+        position[heap[a]] = a;
+        position[heap[b]] = b;
+    }
+
+    void IndexedPriorityQueue::sift_up(size_t p)
+    {
+        while (p > 0 && keys[heap[p]] < keys[heap[(p - 1) / 2]]){
+            swap_places(p, (p - 1) / 2);
+            p = (p - 1) / 2;
+        }
+    }
+
+    void IndexedPriorityQueue::sift_down(size_t p)
+    {
+        size_t n = heap.size();
+        while (true){
+            size_t smallest = p, l = 2 * p + 1, r = 2 * p + 2;
+            if (l < n && keys[heap[l]] < keys[heap[smallest]])
+                smallest = l;
+            if (r < n && keys[heap[r]] < keys[heap[smallest]])
+                smallest = r;
+            if (smallest == p)
+                return;
+            swap_places(p, smallest);
+            p = smallest;
+        }
+    }
+
+    DirectMethod::DirectMethod(const ReactionNetwork& network, const ReactionNetwork::state_t& initial, real_t t0)
+        : network(&network), x(initial), t(t0)
+    {
+        if (initial.size() != network.species()){
+            throw std::invalid_argument("Initial state must have one count per species!");
+        }
+        std::vector<real_t> a(network.reactions());
+        for (size_t r = 0; r < a.size(); r++)
+            a[r] = network.propensity(r, x);
+        table = DynamicTable(a.begin(), a.end());
+    }
+
+    void DirectMethod::fire(size_t r)
+    {
+        network->fire(r, x);
+        for (size_t q : network->dependents(r))
+            table.update(q, network->propensity(q, x));
+    }
+
+    const ReactionNetwork::state_t& DirectMethod::state() const
+    {
+        return x;
+    }
+
+    real_t DirectMethod::time() const
+    {
+        return t;
+    }
+
+    NextReactionMethod::NextReactionMethod(const ReactionNetwork& network, const ReactionNetwork::state_t& initial, real_t t0)
+        : network(&network), x(initial), t(t0), a(network.reactions())
+    {
+        if (initial.size() != network.species()){
+            throw std::invalid_argument("Initial state must have one count per species!");
+        }
+        for (size_t r = 0; r < a.size(); r++){
+            a[r] = network.propensity(r, x);
+            if (!(a[r] >= 0) || std::isinf(a[r])){
+                throw std::invalid_argument("Propensities must be non-negative and finite!");
+            }
+        }
+    }
+
+    const ReactionNetwork::state_t& NextReactionMethod::state() const
+    {
+        return x;
+    }
+
+    real_t NextReactionMethod::time() const
+    {
+        return t;
+    }
+}
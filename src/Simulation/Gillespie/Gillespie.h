@@ -0,0 +1,314 @@
+#ifndef DF_GILLESPIE_H
+#define DF_GILLESPIE_H
+
+#include <vector>
+#include <functional>
+#include <limits>
+
+#include "generator.h"
+#include "../../Parallel/parallel.h"
+
+namespace DiceForge
+{
+    /// @brief DiceForge::ReactionNetwork - A set of reactions between species, for stochastic simulation
+    /// @note Each reaction has a propensity (its rate in the current state) and a change of the state when it fires.
+    /// Reactions whose propensity may change when another fires are worked out as reactions are added
+    class ReactionNetwork
+    {
+    public:
+        /// @brief Number of molecules of every species
+        typedef std::vector<int_t> state_t;
+        /// @brief Propensity of a reaction as a function of the state
+        typedef std::function<real_t(const state_t&)> propensity_t;
+        /// @brief List of (species, number of molecules) pairs
+        typedef std::vector<std::pair<size_t, int_t>> stoichiometry_t;
+
+        /// @brief Constructs a network with no reactions
+        /// @param species number of species
+        ReactionNetwork(size_t species);
+        /// @brief Default destructor
+        ~ReactionNetwork() = default;
+
+        /// @brief Adds a reaction following the law of mass action, returns its index
+        /// @param rate rate constant k (non-negative)
+        /// @param reactants species consumed by the reaction, with their counts
+        /// @param products species produced by the reaction, with their counts
+        /// @note The propensity is k times the number of ways of choosing the reactants, i.e. k x for A -> ..., k x (x - 1) / 2 for 2A -> ...
+        size_t add_reaction(real_t rate, const stoichiometry_t& reactants, const stoichiometry_t& products);
+        /// @brief Adds a reaction with any propensity, returns its index
+        /// @param propensity function returning the propensity in a state (non-negative)
+        /// @param reads species the propensity depends on
+        /// @param change change of the number of molecules of every species when the reaction fires
+        /// @note The propensity may be evaluated from several threads at once by simulate(), so it must not modify shared state
+        size_t add_reaction(propensity_t propensity, const std::vector<size_t>& reads, const stoichiometry_t& change);
+
+        /// @brief Returns the number of species
+        size_t species() const;
+        /// @brief Returns the number of reactions
+        size_t reactions() const;
+        /// @brief Returns the propensity of reaction r in state x
+        real_t propensity(size_t r, const state_t& x) const;
+        /// @brief Applies the change of reaction r to state x
+        void fire(size_t r, state_t& x) const;
+        /// @brief Returns the reactions whose propensity may change when reaction r fires, including r itself
+        const std::vector<size_t>& dependents(size_t r) const;
+
+    private:
+        struct Reaction
+        {
+            real_t rate;                // Rate constant of a mass action reaction
+            stoichiometry_t reactants;  // Reactants of a mass action reaction
+            propensity_t custom;        // Propensity of any other reaction
+            std::vector<size_t> reads;  // Species the propensity depends on
+            stoichiometry_t change;     // Net change of the state, without zeros
+        };
+        size_t n_species;
+        std::vector<Reaction> list;
+        std::vector<std::vector<size_t>> depends;
+
+        void check_species(size_t s) const;
+        void add(Reaction reaction);
+    };
+
+    /// @brief DiceForge::IndexedPriorityQueue - A binary min-heap of the keys of indices 0 to n - 1,
+    /// whose keys can be changed in O(log n) time
+    class IndexedPriorityQueue
+    {
+    public:
+        /// @brief Constructs an empty queue
+        IndexedPriorityQueue() = default;
+        /// @brief Builds the queue of the given keys in O(n) time
+        /// @param keys key of every index
+        IndexedPriorityQueue(const std::vector<real_t>& keys);
+        /// @brief Returns the index with the smallest key
+        size_t top() const;
+        /// @brief Returns the key of index i
+        real_t key(size_t i) const;
+        /// @brief Changes the key of index i, in O(log n) time
+        void update(size_t i, real_t key);
+
+    private:
+        std::vector<real_t> keys;       // Key of every index
+        std::vector<size_t> heap;       // Indices in heap order
+        std::vector<size_t> position;   // Place of every index in the heap
+
+        void swap_places(size_t a, size_t b);
+        void sift_up(size_t p);
+        void sift_down(size_t p);
+    };
+
+    /// @brief DiceForge::DirectMethod - Gillespie's direct method of stochastic simulation
+    /// @note Each step draws the exponential waiting time with the total propensity as rate, and the reaction with probability
+    /// proportional to its propensity. The propensities are kept in a DynamicTable and only those of the dependents
+    /// of the fired reaction are recomputed, so each step takes O(d log M) time for M reactions with d dependents each
+    class DirectMethod
+    {
+    public:
+        /// @brief Starts a simulation
+        /// @param network reactions to simulate, must outlive the simulation
+        /// @param initial initial state
+        /// @param t0 initial time
+        DirectMethod(const ReactionNetwork& network, const ReactionNetwork::state_t& initial, real_t t0 = 0);
+        /// @brief Default destructor
+        ~DirectMethod() = default;
+
+        /// @brief Fires the next reaction, returns false if none can fire (all propensities are zero)
+        /// @param rng any DiceForge RNG or UniformRandomBitGenerator
+        template <typename G>
+        bool step(G& rng)
+        {
+            auto&& g = as_generator(rng);
+            real_t a0 = table.total();
+            if (!(a0 > 0))
+                return false;
+            t -= log(g.next_unit_open()) / a0;
+            fire(table.index(g.next_unit()));
+            return true;
+        }
+
+        /// @brief Runs the simulation up to time t_end
+        /// @param t_end time at which the simulation stops, the state is that at t_end
+        /// @param rng any DiceForge RNG or UniformRandomBitGenerator
+        /// @note The waiting time that overshoots t_end is thrown away, which is exact as it is memoryless
+        template <typename G>
+        void advance(real_t t_end, G& rng)
+        {
+            auto&& g = as_generator(rng);
+            while (true)
+            {
+                real_t a0 = table.total();
+                if (!(a0 > 0))
+                    break;
+                real_t dt = -log(g.next_unit_open()) / a0;
+                if (t + dt > t_end)
+                    break;
+                t += dt;
+                fire(table.index(g.next_unit()));
+            }
+            if (t < t_end)
+                t = t_end;
+        }
+
+        /// @brief Returns the current state
+        const ReactionNetwork::state_t& state() const;
+        /// @brief Returns the current time
+        real_t time() const;
+
+    private:
+        const ReactionNetwork* network;
+        ReactionNetwork::state_t x;
+        real_t t;
+        DynamicTable table;     // Propensity of every reaction
+
+        void fire(size_t r);
+    };
+
+    /// @brief DiceForge::NextReactionMethod - Gibson and Bruck's next reaction method of stochastic simulation
+    /// @note Every reaction has the absolute time at which it fires next, kept in an IndexedPriorityQueue. After the earliest one
+    /// fires, the times of its dependents are rescaled to their new propensities instead of drawn again, so each step draws one
+    /// random number and takes O(d log M) time for M reactions with d dependents each
+    class NextReactionMethod
+    {
+    public:
+        /// @brief Starts a simulation
+        /// @param network reactions to simulate, must outlive the simulation
+        /// @param initial initial state
+        /// @param t0 initial time
+        /// @note The firing times are drawn with the RNG of the first call to step() or advance()
+        NextReactionMethod(const ReactionNetwork& network, const ReactionNetwork::state_t& initial, real_t t0 = 0);
+        /// @brief Default destructor
+        ~NextReactionMethod() = default;
+
+        /// @brief Fires the next reaction, returns false if none can fire (all propensities are zero)
+        /// @param rng any DiceForge RNG or UniformRandomBitGenerator
+        template <typename G>
+        bool step(G& rng)
+        {
+            auto&& g = as_generator(rng);
+            if (!started)
+                start(g);
+            if (a.empty())
+                return false;
+            size_t r = queue.top();
+            if (queue.key(r) == infinity)
+                return false;
+            t = queue.key(r);
+            fire(r, g);
+            return true;
+        }
+
+        /// @brief Runs the simulation up to time t_end
+        /// @param t_end time at which the simulation stops, the state is that at t_end
+        /// @param rng any DiceForge RNG or UniformRandomBitGenerator
+        template <typename G>
+        void advance(real_t t_end, G& rng)
+        {
+            auto&& g = as_generator(rng);
+            if (!started)
+                start(g);
+            while (!a.empty())
+            {
+                size_t r = queue.top();
+                if (queue.key(r) == infinity || queue.key(r) > t_end)
+                    break;
+                t = queue.key(r);
+                fire(r, g);
+            }
+            if (t < t_end)
+                t = t_end;
+        }
+
+        /// @brief Returns the current state
+        const ReactionNetwork::state_t& state() const;
+        /// @brief Returns the current time
+        real_t time() const;
+
+    private:
+        static constexpr real_t infinity = std::numeric_limits<real_t>::infinity();
+        const ReactionNetwork* network;
+        ReactionNetwork::state_t x;
+        real_t t;
+        std::vector<real_t> a;          // Propensity of every reaction
+        IndexedPriorityQueue queue;     // Next firing time of every reaction
+        bool started = false;
+
+        template <typename G>
+        void start(G& g)
+        {
+            std::vector<real_t> times(a.size());
+            for (size_t r = 0; r < a.size(); r++)
+                times[r] = a[r] > 0 ? t - log(g.next_unit_open()) / a[r] : infinity;
+            queue = IndexedPriorityQueue(times);
+            started = true;
+        }
+
+        template <typename G>
+        void fire(size_t mu, G& g)
+        {
+            network->fire(mu, x);
+            for (size_t r : network->dependents(mu))
+            {
+                real_t a_new = network->propensity(r, x);
+                real_t next = infinity;
+                if (a_new > 0) {
+                    // Waiting times left over from before are rescaled, fresh ones are drawn for the fired reaction and the revived ones
+                    if (r != mu && a[r] > 0)
+                        next = t + (a[r] / a_new) * (queue.key(r) - t);
+                    else
+                        next = t - log(g.next_unit_open()) / a_new;
+                }
+                a[r] = a_new;
+                queue.update(r, next);
+            }
+        }
+    };
+
+    /// @brief Simulates independent trajectories of a reaction network in parallel, returns the state of each at the given times
+    /// @tparam Method DirectMethod or NextReactionMethod
+    /// @param network reactions to simulate
+    /// @param initial initial state of every trajectory, at time zero
+    /// @param times increasing times at which the states are recorded
+    /// @param trajectories number of trajectories
+    /// @param seed seed of the substreams, if it is zero the current system time is used
+    /// @param threads number of threads, zero for as many as the hardware runs concurrently
+    /// @note Trajectory i draws from substream(seed, i), so the result only depends on the seed, not on the number of threads
+    template <typename Method = DirectMethod>
+    std::vector<std::vector<ReactionNetwork::state_t>> simulate(const ReactionNetwork& network, const ReactionNetwork::state_t& initial,
+                                                                const std::vector<real_t>& times, size_t trajectories,
+                                                                uint64_t seed, unsigned threads = 0)
+    {
+        seed = parallel_seed(seed);
+        std::vector<std::vector<ReactionNetwork::state_t>> result(trajectories);
+        parallel_for(trajectories, threads, [&](size_t i) {
+            Philox4x32 rng = substream(seed, i);
+            Method simulation(network, initial);
+            result[i].reserve(times.size());
+            for (real_t t : times) {
+                simulation.advance(t, rng);
+                result[i].push_back(simulation.state());
+            }
+        });
+        return result;
+    }
+
+    /// @brief Simulates independent trajectories of a reaction network in parallel, returns the state of each at time t_end
+    /// @tparam Method DirectMethod or NextReactionMethod
+    /// @param network reactions to simulate
+    /// @param initial initial state of every trajectory, at time zero
+    /// @param t_end time at which the states are recorded
+    /// @param trajectories number of trajectories
+    /// @param seed seed of the substreams, if it is zero the current system time is used
+    /// @param threads number of threads, zero for as many as the hardware runs concurrently
+    template <typename Method = DirectMethod>
+    std::vector<ReactionNetwork::state_t> simulate(const ReactionNetwork& network, const ReactionNetwork::state_t& initial,
+                                                   real_t t_end, size_t trajectories, uint64_t seed, unsigned threads = 0)
+    {
+        std::vector<ReactionNetwork::state_t> result;
+        result.reserve(trajectories);
+        for (auto& states : simulate<Method>(network, initial, std::vector<real_t>(1, t_end), trajectories, seed, threads))
+            result.push_back(std::move(states[0]));
+        return result;
+    }
+}
+
+#endif
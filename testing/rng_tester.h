@@ -5,6 +5,8 @@
 
 #include <chrono>
 #include <vector>
+#include <random>
+#include <algorithm>
 
 /// @brief test_scatter - generates data for a scatter plot
 /// @param G random number generator to be tested
@@ -128,4 +130,120 @@ double test_time_floats(DiceForge::Generator<T>& G, int count)
     return (end - start).count() * 1e-6;
 }
 
-#endif 
+/// @brief test_time_bulk_integers - calculates the time taken by the RNG to generate the specified count of integers
+/// through the bulk fill API, in blocks of 4096
+/// @param G random number generator to be tested
+/// @param count number of random integers to be generated 
+/// @return time taken to generate the numbers in milliseconds
+template <typename T>
+double test_time_bulk_integers(DiceForge::Generator<T>& G, int count)
+{
+    std::vector<T> block(4096);
+
+    std::chrono::time_point start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < count; i += block.size())
+    {
+        G.fill(block.data(), std::min<size_t>(block.size(), count - i));
+    }    
+
+    std::chrono::time_point end = std::chrono::high_resolution_clock::now();
+
+    return (end - start).count() * 1e-6;
+}
+
+/// @brief test_time_bulk_floats - calculates the time taken by the RNG to generate the specified count of floats
+/// through the bulk fill API, in blocks of 4096
+/// @param G random number generator to be tested
+/// @param count number of random floats to be generated 
+/// @return time taken to generate the numbers in milliseconds
+template <typename T>
+double test_time_bulk_floats(DiceForge::Generator<T>& G, int count)
+{
+    std::vector<double> block(4096);
+
+    std::chrono::time_point start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < count; i += block.size())
+    {
+        G.fill_unit(block.data(), std::min<size_t>(block.size(), count - i));
+    }    
+
+    std::chrono::time_point end = std::chrono::high_resolution_clock::now();
+
+    return (end - start).count() * 1e-6;
+}
+
+/// @brief test_time_std_normal - calculates the time taken to draw the specified count of std::normal_distribution
+/// samples with the RNG
+/// @param G random number generator to be tested, DiceForge or standard library (any UniformRandomBitGenerator)
+/// @param count number of samples to be drawn
+/// @return time taken to draw the samples in milliseconds
+template <typename URBG>
+double test_time_std_normal(URBG& G, int count)
+{
+    std::normal_distribution<double> dist(0.0, 1.0);
+    double sum = 0;
+
+    std::chrono::time_point start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < count; i++)
+    {
+        sum += dist(G);
+    }
+
+    std::chrono::time_point end = std::chrono::high_resolution_clock::now();
+
+    volatile double sink = sum;
+    (void)sink;
+    return (end - start).count() * 1e-6;
+}
+
+/// @brief test_time_sampler - calculates the time taken to draw the specified count of samples from a sampler
+/// of a DiceForge distribution with the RNG
+/// @param S sampler of the distribution (returned by prepare())
+/// @param G random number generator to be tested, DiceForge or standard library (any UniformRandomBitGenerator)
+/// @param count number of samples to be drawn
+/// @return time taken to draw the samples in milliseconds
+template <typename Sampler, typename URBG>
+double test_time_sampler(const Sampler& S, URBG& G, int count)
+{
+    double sum = 0;
+
+    std::chrono::time_point start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < count; i++)
+    {
+        sum += S(G);
+    }
+
+    std::chrono::time_point end = std::chrono::high_resolution_clock::now();
+
+    volatile double sink = sum;
+    (void)sink;
+    return (end - start).count() * 1e-6;
+}
+
+/// @brief test_time_std_shuffle - calculates the time taken by std::shuffle to shuffle an array of the specified size
+/// @param G random number generator to be tested, DiceForge or standard library (any UniformRandomBitGenerator)
+/// @param count size of the array
+/// @return time taken to shuffle the array in milliseconds
+template <typename URBG>
+double test_time_std_shuffle(URBG& G, int count)
+{
+    std::vector<int> v(count);
+    for (int i = 0; i < count; i++)
+    {
+        v[i] = i;
+    }
+
+    std::chrono::time_point start = std::chrono::high_resolution_clock::now();
+
+    std::shuffle(v.begin(), v.end(), G);
+
+    std::chrono::time_point end = std::chrono::high_resolution_clock::now();
+
+    return (end - start).count() * 1e-6;
+}
+
+#endif
@@ -0,0 +1,47 @@
+#include "diceforge.h"
+#include <time.h>
+#include <iostream>
+
+/// @brief report - prints the mean and variance of the number of molecules over the trajectories
+/// @param name name of the simulation method
+/// @param states state of every trajectory
+/// @param expected mean and variance of the stationary distribution
+void report(const char* name, const std::vector<DiceForge::ReactionNetwork::state_t>& states, double expected)
+{
+    DiceForge::RunningStats stats;
+    for (auto& x : states)
+        stats.add(x[0]);
+    std::cout << name << "\tmean " << stats.mean() << " +- " << stats.std_error()
+              << "\tvariance " << stats.variance() << "\t(expected " << expected << " for both)" << std::endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    size_t trajectories = argc >= 2 ? atoll(argv[1]) : 10000;
+    DiceForge::uint64_t seed = argc >= 3 ? atoll(argv[2]) : time(NULL);
+
+    // Birth-death process, 0 -> A at rate k1 and A -> 0 at rate k2 x, whose stationary distribution is Poisson(k1 / k2)
+    const double k1 = 10, k2 = 1, t_end = 50;
+    DiceForge::ReactionNetwork network = DiceForge::ReactionNetwork(1);
+    network.add_reaction(k1, {}, {{0, 1}});
+    network.add_reaction(k2, {{0, 1}}, {});
+
+    std::cout << "Simulating " << trajectories << " trajectories of a birth-death process up to t = " << t_end
+              << ", starting from no molecules\n\n";
+
+    report("direct method", DiceForge::simulate<DiceForge::DirectMethod>(network, {0}, t_end, trajectories, seed), k1 / k2);
+    report("next reaction", DiceForge::simulate<DiceForge::NextReactionMethod>(network, {0}, t_end, trajectories, seed), k1 / k2);
+
+    // Pure decay, A -> 0, runs out of reactions after the last molecule, so both methods must stop there even with no end time
+    DiceForge::ReactionNetwork decay = DiceForge::ReactionNetwork(1);
+    decay.add_reaction(k2, {{0, 1}}, {});
+    DiceForge::Philox4x32 rng = DiceForge::Philox4x32(seed);
+    DiceForge::DirectMethod direct = DiceForge::DirectMethod(decay, {5});
+    DiceForge::NextReactionMethod next = DiceForge::NextReactionMethod(decay, {5});
+    direct.advance(INFINITY, rng);
+    next.advance(INFINITY, rng);
+    std::cout << "\nDecay of 5 molecules up to t = infinity\tdirect method " << direct.state()[0]
+              << "\tnext reaction " << next.state()[0] << "\t(expected 0 for both)" << std::endl;
+
+    return 0;
+}
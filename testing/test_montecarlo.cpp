@@ -43,6 +43,11 @@ int main(int argc, char const *argv[])
 
     std::cout << "pi = " << pi << std::endl;
 
+    // The same estimate with the parallel integrator, sampling on all cores until the standard error is 0.001
+    auto quarter_circle = [](const std::vector<double>& p) { return p[0]*p[0] + p[1]*p[1] <= 1 ? 4.0 : 0.0; };
+    DiceForge::IntegrationResult result = DiceForge::monte_carlo_integrate(quarter_circle, {0, 0}, {1, 1}, 0.001, 100000000, time(NULL));
+    std::cout << "pi = " << result.value << " +- " << result.std_error << " (" << result.samples << " samples)" << std::endl;
+
     FILE* gnuplot = popen("gnuplot -persist", "w");
     fprintf(gnuplot, "set label 'π = %f' at 0.3, 0.3\n", pi);
     fprintf(gnuplot, "set label 'samples = %d' at 0.3, 0.35\n", num_samples);
@@ -52,26 +52,29 @@ void test_all_time(const size_t N)
     DiceForge::LFSR32 lfsr1 = DiceForge::LFSR32(123);
     DiceForge::LFSR64 lfsr2 = DiceForge::LFSR64(123);
     DiceForge::NaorReingold32 nr = DiceForge::NaorReingold32(123);
+    DiceForge::Philox4x32 ph = DiceForge::Philox4x32(123);
 
     std::cout << "Time performance" << std::endl;
 
-    std::cout << "BBS32\tfloats: " << test_time_floats(bb1, N) << "ms, ints: " << test_time_integers(bb1, N) << "ms" <<  std::endl;
+    std::cout << "BBS32\tfloats: " << test_time_floats(bb1, N) << "ms, ints: " << test_time_integers(bb1, N) << "ms, bulk floats: " << test_time_bulk_floats(bb1, N) << "ms, bulk ints: " << test_time_bulk_integers(bb1, N) << "ms" <<  std::endl;
 
-    std::cout << "BBS64\tfloats: " << test_time_floats(bb2, N) << "ms, ints: " << test_time_integers(bb2, N) << "ms" <<  std::endl;
+    std::cout << "BBS64\tfloats: " << test_time_floats(bb2, N) << "ms, ints: " << test_time_integers(bb2, N) << "ms, bulk floats: " << test_time_bulk_floats(bb2, N) << "ms, bulk ints: " << test_time_bulk_integers(bb2, N) << "ms" <<  std::endl;
 
-    std::cout << "XOR32\tfloats: " << test_time_floats(xs1, N) << "ms, ints: " << test_time_integers(xs1, N) << "ms" <<  std::endl;
+    std::cout << "XOR32\tfloats: " << test_time_floats(xs1, N) << "ms, ints: " << test_time_integers(xs1, N) << "ms, bulk floats: " << test_time_bulk_floats(xs1, N) << "ms, bulk ints: " << test_time_bulk_integers(xs1, N) << "ms" <<  std::endl;
 
-    std::cout << "XOR64\tfloats: " << test_time_floats(xs2, N) << "ms, ints: " << test_time_integers(xs2, N) << "ms" <<  std::endl;
+    std::cout << "XOR64\tfloats: " << test_time_floats(xs2, N) << "ms, ints: " << test_time_integers(xs2, N) << "ms, bulk floats: " << test_time_bulk_floats(xs2, N) << "ms, bulk ints: " << test_time_bulk_integers(xs2, N) << "ms" <<  std::endl;
 
-    std::cout << "MT32\tfloats: " << test_time_floats(mt1, N) << "ms, ints: " << test_time_integers(mt1, N) << "ms" <<  std::endl;
+    std::cout << "MT32\tfloats: " << test_time_floats(mt1, N) << "ms, ints: " << test_time_integers(mt1, N) << "ms, bulk floats: " << test_time_bulk_floats(mt1, N) << "ms, bulk ints: " << test_time_bulk_integers(mt1, N) << "ms" <<  std::endl;
 
-    std::cout << "MT64\tfloats: " << test_time_floats(mt2, N) << "ms, ints: " << test_time_integers(mt2, N)  << "ms" <<  std::endl;
+    std::cout << "MT64\tfloats: " << test_time_floats(mt2, N) << "ms, ints: " << test_time_integers(mt2, N)  << "ms, bulk floats: " << test_time_bulk_floats(mt2, N) << "ms, bulk ints: " << test_time_bulk_integers(mt2, N) << "ms" <<  std::endl;
 
-    std::cout << "LFSR32\tfloats: " << test_time_floats(lfsr1, N) << "ms, ints: " << test_time_integers(lfsr1, N) << "ms" <<  std::endl;
+    std::cout << "LFSR32\tfloats: " << test_time_floats(lfsr1, N) << "ms, ints: " << test_time_integers(lfsr1, N) << "ms, bulk floats: " << test_time_bulk_floats(lfsr1, N) << "ms, bulk ints: " << test_time_bulk_integers(lfsr1, N) << "ms" <<  std::endl;
 
-    std::cout << "LFSR64\tfloats: " << test_time_floats(lfsr2, N) << "ms, ints: " << test_time_integers(lfsr2, N)  << "ms" <<  std::endl;
+    std::cout << "LFSR64\tfloats: " << test_time_floats(lfsr2, N) << "ms, ints: " << test_time_integers(lfsr2, N)  << "ms, bulk floats: " << test_time_bulk_floats(lfsr2, N) << "ms, bulk ints: " << test_time_bulk_integers(lfsr2, N) << "ms" <<  std::endl;
 
-    std::cout << "NR\tfloats: " << test_time_floats(nr, N) << "ms, ints: " << test_time_integers(nr, N)  << "ms" <<  std::endl;
+    std::cout << "NR\tfloats: " << test_time_floats(nr, N) << "ms, ints: " << test_time_integers(nr, N)  << "ms, bulk floats: " << test_time_bulk_floats(nr, N) << "ms, bulk ints: " << test_time_bulk_integers(nr, N) << "ms" <<  std::endl;
+
+    std::cout << "Philox\tfloats: " << test_time_floats(ph, N) << "ms, ints: " << test_time_integers(ph, N)  << "ms, bulk floats: " << test_time_bulk_floats(ph, N) << "ms, bulk ints: " << test_time_bulk_integers(ph, N) << "ms" <<  std::endl;
 
     std::random_device rd{};    
     std::mt19937 engine{rd()};
@@ -84,6 +87,21 @@ void test_all_time(const size_t N)
     std::chrono::time_point end_c1 = std::chrono::high_resolution_clock::now();
 
     std::cout << "C++ MT: " << (end_c1 - start_c1).count() * 1.e-6 << "ms" <<  std::endl;
+
+    // Every DiceForge RNG is a UniformRandomBitGenerator, and the DiceForge distributions take any of them
+    std::mt19937 mt_std{123};
+    DiceForge::Gaussian normal = DiceForge::Gaussian(0, 1);
+    DiceForge::Gaussian::Sampler gaussian = normal.prepare();
+
+    std::cout << "\nInteroperability with the standard library" << std::endl;
+
+    std::cout << "std::mt19937\tstd::normal: " << test_time_std_normal(mt_std, N) << "ms, Gaussian: " << test_time_sampler(gaussian, mt_std, N) << "ms, std::shuffle: " << test_time_std_shuffle(mt_std, N) << "ms" << std::endl;
+
+    std::cout << "MT64\t\tstd::normal: " << test_time_std_normal(mt2, N) << "ms, Gaussian: " << test_time_sampler(gaussian, mt2, N) << "ms, std::shuffle: " << test_time_std_shuffle(mt2, N) << "ms" << std::endl;
+
+    std::cout << "XOR64\t\tstd::normal: " << test_time_std_normal(xs2, N) << "ms, Gaussian: " << test_time_sampler(gaussian, xs2, N) << "ms, std::shuffle: " << test_time_std_shuffle(xs2, N) << "ms" << std::endl;
+
+    std::cout << "Philox\t\tstd::normal: " << test_time_std_normal(ph, N) << "ms, Gaussian: " << test_time_sampler(gaussian, ph, N) << "ms, std::shuffle: " << test_time_std_shuffle(ph, N) << "ms" << std::endl;
 }
 
 void test_all_stats(const size_t N)
@@ -97,6 +115,7 @@ void test_all_stats(const size_t N)
     DiceForge::LFSR32 lfsr1 = DiceForge::LFSR32(123);
     DiceForge::LFSR64 lfsr2 = DiceForge::LFSR64(123);
     DiceForge::NaorReingold32 nr = DiceForge::NaorReingold32(123);
+    DiceForge::Philox4x32 ph = DiceForge::Philox4x32(123);
 
     std::cout << "Statistical performance" << std::endl;
 
@@ -127,5 +146,8 @@ void test_all_stats(const size_t N)
     stats = test_statistical(nr, N);
     std::cout << "NR\tmean: " << stats[0] << ", variance: " << stats[1] <<  std::endl;
 
+    stats = test_statistical(ph, N);
+    std::cout << "Philox\tmean: " << stats[0] << ", variance: " << stats[1] <<  std::endl;
+
     std::cout << "\n\n";
 }
\ No newline at end of file
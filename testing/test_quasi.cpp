@@ -0,0 +1,114 @@
+#include "diceforge.h"
+#include <time.h>
+#include <iostream>
+#include <iomanip>
+
+/// @brief check_known - compares the first points of a sequence with known answers
+/// @param name name of the sequence
+/// @param q sequence, at its first point
+/// @param expected coordinates of the first points, one row per point
+/// @return true if every coordinate is within 1e-9 of the known answer
+template <size_t D, size_t N>
+bool check_known(const char* name, DiceForge::QuasiGenerator& q, const double (&expected)[N][D])
+{
+    bool ok = true;
+    std::cout << name << std::endl;
+    for (size_t i = 0; i < N; i++)
+    {
+        std::vector<double> p = q.next();
+        std::cout << "  " << i << ":";
+        for (size_t d = 0; d < D; d++)
+        {
+            std::cout << " " << std::setw(10) << p[d];
+            ok = ok && std::abs(p[d] - expected[i][d]) < 1e-9;
+        }
+        std::cout << std::endl;
+    }
+    return ok;
+}
+
+/// @brief check_skip - compares the point reached by skip_to(i) with the one reached by i calls to next()
+/// @param q sequence, at its first point
+/// @param i index of the point
+/// @return true if both points are the same
+bool check_skip(DiceForge::QuasiGenerator& q, DiceForge::uint64_t i)
+{
+    for (DiceForge::uint64_t k = 0; k < i; k++)
+        q.next();
+    std::vector<double> stepped = q.next();
+    q.skip_to(i);
+    return q.next() == stepped;
+}
+
+/// @brief integrand - product of (pi / 2) sin(pi x) over the coordinates, whose integral over the unit cube is 1
+double integrand(const std::vector<double>& x)
+{
+    double f = 1;
+    for (double xd : x)
+        f *= M_PI / 2 * sin(M_PI * xd);
+    return f;
+}
+
+int main(int argc, char const *argv[])
+{
+    DiceForge::uint64_t seed = argc >= 2 ? atoll(argv[1]) : time(NULL);
+
+    // First points of the Joe-Kuo Sobol sequence, each coordinate centred in its cell of width 2^-32
+    const double h = 0x1p-33;
+    const double sobol_points[8][3] = {
+        {h, h, h}, {0.5 + h, 0.5 + h, 0.5 + h}, {0.75 + h, 0.25 + h, 0.25 + h}, {0.25 + h, 0.75 + h, 0.75 + h},
+        {0.375 + h, 0.375 + h, 0.625 + h}, {0.875 + h, 0.875 + h, 0.125 + h},
+        {0.625 + h, 0.125 + h, 0.875 + h}, {0.125 + h, 0.625 + h, 0.375 + h}
+    };
+    // First points of the Halton sequence in bases 2, 3 and 5, starting from index 1
+    const double halton_points[4][3] = {
+        {1.0 / 2, 1.0 / 3, 1.0 / 5}, {1.0 / 4, 2.0 / 3, 2.0 / 5},
+        {3.0 / 4, 1.0 / 9, 3.0 / 5}, {1.0 / 8, 4.0 / 9, 4.0 / 5}
+    };
+
+    DiceForge::Sobol sobol = DiceForge::Sobol(3);
+    DiceForge::Halton halton = DiceForge::Halton(3);
+    bool sobol_ok = check_known("Sobol", sobol, sobol_points);
+    bool halton_ok = check_known("Halton", halton, halton_points);
+    std::cout << "known answers\tSobol " << (sobol_ok ? "ok" : "FAILED") << "\tHalton " << (halton_ok ? "ok" : "FAILED") << "\n\n";
+
+    // skip_to against stepping, for every scrambling (Halton has no Owen scrambling)
+    bool skip_ok = true;
+    const DiceForge::Scrambling scramblings[3] = {DiceForge::Scrambling::none, DiceForge::Scrambling::shift, DiceForge::Scrambling::owen};
+    for (DiceForge::Scrambling s : scramblings)
+    {
+        for (DiceForge::uint64_t i : {1, 2, 7, 100, 1000, 4097})
+        {
+            DiceForge::Sobol sq = DiceForge::Sobol(8, s, seed);
+            skip_ok = skip_ok && check_skip(sq, i);
+            if (s != DiceForge::Scrambling::owen) {
+                DiceForge::Halton hq = DiceForge::Halton(8, s, seed);
+                skip_ok = skip_ok && check_skip(hq, i);
+            }
+        }
+    }
+    std::cout << "skip_to(i) against i calls to next()\t" << (skip_ok ? "ok" : "FAILED") << "\n\n";
+
+    // Error of the average of the integrand over n points, quasi-random against pseudo-random
+    const size_t dims = 5;
+    std::cout << "Integral of a product of sines over [0, 1]^" << dims << " (exact value 1), absolute error\n";
+    std::cout << "n\tSobol (owen)\tHalton (shift)\tPhilox4x32\n";
+    for (size_t n = 1 << 8; n <= 1 << 16; n <<= 2)
+    {
+        DiceForge::Sobol sq = DiceForge::Sobol(dims, DiceForge::Scrambling::owen, seed);
+        DiceForge::Halton hq = DiceForge::Halton(dims, DiceForge::Scrambling::shift, seed);
+        DiceForge::Philox4x32 rng = DiceForge::Philox4x32(seed);
+        double s_sum = 0, h_sum = 0, r_sum = 0;
+        std::vector<double> x(dims);
+        for (size_t i = 0; i < n; i++)
+        {
+            s_sum += integrand(sq.next());
+            h_sum += integrand(hq.next());
+            rng.fill_unit(x.data(), dims);
+            r_sum += integrand(x);
+        }
+        std::cout << n << "\t" << std::abs(s_sum / n - 1) << "\t" << std::abs(h_sum / n - 1) << "\t" << std::abs(r_sum / n - 1) << std::endl;
+    }
+
+    return sobol_ok && halton_ok && skip_ok ? 0 : 1;
+}
@@ -0,0 +1,67 @@
+#include "diceforge.h"
+#include <chrono>
+#include <iostream>
+
+#if (__cplusplus >= 202002L)
+#include <random>
+static_assert(std::uniform_random_bit_generator<DiceForge::StaticXORShift64>);
+static_assert(DiceForge::UniformGenerator<DiceForge::StaticXORShift64>);
+static_assert(DiceForge::UniformGenerator<DiceForge::XORShift64>);
+#endif
+
+/// @brief time_ms - times the given sampling loop
+/// @param f function drawing N samples and returning their sum
+/// @param sum receives the sum, so that the loop is not optimised away
+/// @return time taken in milliseconds
+template <typename F>
+double time_ms(F f, double& sum)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    sum = f();
+    auto stop = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+int main(int argc, char const *argv[])
+{
+    size_t N = argc >= 2 ? atoll(argv[1]) : 100000000;
+    std::cout << "Drawing " << N << " exponential samples with XORShift64\n\n";
+
+    DiceForge::Exponential e = DiceForge::Exponential(2.0);
+    DiceForge::Exponential::Sampler sampler = e.prepare();
+
+    // Virtual path, every number goes through Generator::generate()
+    DiceForge::XORShift64 xs = DiceForge::XORShift64(123);
+    DiceForge::Generator<DiceForge::uint64_t>& rng = xs;
+
+    // Static path, the same numbers with generate() inlined into the sampler
+    DiceForge::StaticXORShift64 sxs = DiceForge::StaticXORShift64(123);
+
+    double sum;
+    double t = time_ms([&]() {
+        double s = 0;
+        for (size_t i = 0; i < N; i++)
+            s += e.next(rng.next_unit());
+        return s;
+    }, sum);
+    std::cout << "virtual, next(r)\t" << t << " ms\tmean " << sum / N << std::endl;
+
+    xs.reset_seed(123);
+    t = time_ms([&]() {
+        double s = 0;
+        for (size_t i = 0; i < N; i++)
+            s += sampler(rng);
+        return s;
+    }, sum);
+    std::cout << "virtual, sampler\t" << t << " ms\tmean " << sum / N << std::endl;
+
+    t = time_ms([&]() {
+        double s = 0;
+        for (size_t i = 0; i < N; i++)
+            s += sampler(sxs);
+        return s;
+    }, sum);
+    std::cout << "static, sampler \t" << t << " ms\tmean " << sum / N << std::endl;
+
+    return 0;
+}